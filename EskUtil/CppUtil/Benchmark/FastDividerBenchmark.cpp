@@ -0,0 +1,157 @@
+﻿/**
+* @file			FastDividerBenchmark.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		FastDivider / DivConst와 하드웨어 '/' 나눗셈 비교 벤치마크 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		빌드 예)
+*				g++ -std=c++20 -O2 -I.. FastDividerBenchmark.cpp -o FastDividerBenchmark            (스칼라 경로)
+*				g++ -std=c++20 -O2 -mavx2 -I.. FastDividerBenchmark.cpp -o FastDividerBenchmark     (AVX2 배열 경로)
+*				cl /std:c++20 /O2 /arch:AVX2 /EHsc /I.. FastDividerBenchmark.cpp
+*				각 행은 원소당 나노초 (작을수록 빠름), 모든 결과는 '/'와 비교해 다르면 MISMATCH 표시
+*/
+
+#include "Calculate.h"
+#include "Time.h"
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    constexpr size_t DATA_COUNT = static_cast<size_t>(1) << 20;
+    constexpr int REPEAT_COUNT = 32;
+
+    /**
+    * @brief        func(pSrc, pDst)를 REPEAT_COUNT번 실행한 원소당 시간 (ns)
+    */
+    template <typename Func>
+    double Measure(Func func)
+    {
+        const uint64_t nStart = time::GetMonotonicNanos();
+        for (int i = 0; i < REPEAT_COUNT; ++i)
+        {
+            func();
+        }
+        return static_cast<double>(time::GetMonotonicNanos() - nStart) / (static_cast<double>(DATA_COUNT) * REPEAT_COUNT);
+    }
+
+    template <typename T>
+    std::vector<T> MakeData()
+    {
+        std::mt19937_64 rng(12345);
+        std::vector<T> vData(DATA_COUNT);
+        for (T& nValue : vData)
+        {
+            nValue = static_cast<T>(rng());
+        }
+        return vData;
+    }
+
+    template <typename T>
+    const char* GetTypeName() noexcept
+    {
+        if constexpr (std::is_same_v<T, int32_t>)
+        {
+            return "int32 ";
+        }
+        else if constexpr (std::is_same_v<T, uint32_t>)
+        {
+            return "uint32";
+        }
+        else if constexpr (std::is_same_v<T, int64_t>)
+        {
+            return "int64 ";
+        }
+        else
+        {
+            return "uint64";
+        }
+    }
+
+    /**
+    * @brief        하드웨어 '/', FastDivider 스칼라/배열, (부호 있는 형식이면) DivConst 스칼라/배열 비교
+    * @tparam       N               DivConst 제수 (nDivisor와 같은 값)
+    * @param[in]    nDivisor        실행 중에 정해지는 제수 (volatile로 읽어 컴파일러가 상수로 바꾸지 못하게 함)
+    */
+    template <typename T, int64_t N>
+    void RunDivisor(const volatile T& nDivisor)
+    {
+        const std::vector<T> vSrc = MakeData<T>();
+        std::vector<T> vExpected(DATA_COUNT);
+        std::vector<T> vDst(DATA_COUNT);
+        const T nRuntimeDivisor = nDivisor;
+
+        const double dHardware = Measure([&]()
+            {
+                for (size_t i = 0; i < DATA_COUNT; ++i)
+                {
+                    vExpected[i] = vSrc[i] / nRuntimeDivisor;
+                }
+            });
+
+        bool bIsMatched = true;
+        const calc::FastDivider<T> divider(nRuntimeDivisor);
+        const double dFastScalar = Measure([&]()
+            {
+                for (size_t i = 0; i < DATA_COUNT; ++i)
+                {
+                    vDst[i] = divider.Div(vSrc[i]);
+                }
+            });
+        bIsMatched &= vDst == vExpected;
+        const double dFastBatch = Measure([&]() { divider.Div(vSrc.data(), vDst.data(), DATA_COUNT); });
+        bIsMatched &= vDst == vExpected;
+
+        std::printf("%s / %-11lld  hardware %6.3f  FastDivider %6.3f (x%4.1f)  batch %6.3f (x%4.1f)",
+            GetTypeName<T>(), static_cast<long long>(N), dHardware, dFastScalar, dHardware / dFastScalar, dFastBatch, dHardware / dFastBatch);
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            const double dConstScalar = Measure([&]()
+                {
+                    for (size_t i = 0; i < DATA_COUNT; ++i)
+                    {
+                        vDst[i] = calc::DivConst<N>::Div(vSrc[i]);
+                    }
+                });
+            bIsMatched &= vDst == vExpected;
+            const double dConstBatch = Measure([&]() { calc::DivConst<N>::Div(vSrc.data(), vDst.data(), DATA_COUNT); });
+            bIsMatched &= vDst == vExpected;
+            std::printf("  DivConst %6.3f (x%4.1f)  batch %6.3f (x%4.1f)",
+                dConstScalar, dHardware / dConstScalar, dConstBatch, dHardware / dConstBatch);
+        }
+        std::printf("%s\n", bIsMatched ? "" : "  MISMATCH");
+    }
+
+    template <typename T, int64_t N>
+    void Run()
+    {
+        static volatile T s_nDivisor;
+        s_nDivisor = static_cast<T>(N);
+        RunDivisor<T, N>(s_nDivisor);
+    }
+}
+
+int main()
+{
+    // 곱셈만으로 끝나는 제수(10, 1000)와 보정 덧셈이 필요한 제수(7), 음수 제수
+    Run<int32_t, 7>();
+    Run<int32_t, 10>();
+    Run<int32_t, 1000>();
+    Run<int32_t, -3>();
+    Run<uint32_t, 7>();
+    Run<uint32_t, 10>();
+    Run<uint32_t, 1000>();
+    Run<int64_t, 7>();
+    Run<int64_t, 1000>();
+    Run<int64_t, -1000000007>();
+    Run<uint64_t, 7>();
+    Run<uint64_t, 1000>();
+    Run<uint64_t, 1000000007>();
+    return 0;
+}
\ No newline at end of file
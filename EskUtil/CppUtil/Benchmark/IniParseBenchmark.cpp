@@ -0,0 +1,229 @@
+﻿/**
+* @file			IniParseBenchmark.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		IniDocument 파싱 벤치마크 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		생성한 큰 INI 텍스트를 IniDocument(첫 글자 분기 + SIMD 탐색)와 이전 줄 단위 파서(memchr + Trim + find)로 파싱해 비교한다.
+*				두 파서 모두 같은 해시 색인을 만들므로, 색인 없이 토큰만 나누는 시간도 따로 출력한다.
+*				빌드 예)
+*				g++ -std=c++20 -O2 -I.. IniParseBenchmark.cpp -o IniParseBenchmark
+*				g++ -std=c++20 -O2 -mavx2 -I.. IniParseBenchmark.cpp -o IniParseBenchmark
+*				cl /std:c++20 /O2 /arch:AVX2 /EHsc /I.. IniParseBenchmark.cpp
+*				실행: IniParseBenchmark [섹션 수 (기본 2000)] [섹션당 키 수 (기본 200)]
+*/
+
+#include "Ini.h"
+#include "Time.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    constexpr int REPEAT_COUNT = 5;
+
+    /**
+    * @brief        이전(줄 단위) IniDocument 파서 (비교 기준)
+    */
+    class BaselineIni
+    {
+    public:
+        void LoadText(std::string_view svText)
+        {
+            m_vBuffer.assign(svText.begin(), svText.end());
+            m_mapSections.clear();
+            m_vEntries.clear();
+
+            const char* pCur = m_vBuffer.data();
+            const char* pEnd = pCur + m_vBuffer.size();
+            std::string_view svSection;
+            KeyIndex* pKeys = &m_mapSections[svSection];
+            while (pCur < pEnd)
+            {
+                const char* pLineEnd = static_cast<const char*>(::memchr(pCur, '\n', pEnd - pCur));
+                if (pLineEnd == nullptr)
+                {
+                    pLineEnd = pEnd;
+                }
+
+                std::string_view svLine = Trim(std::string_view(pCur, pLineEnd - pCur));
+                pCur = pLineEnd + 1;
+                if (svLine.empty() ||
+                    svLine.front() == ';' ||
+                    svLine.front() == '#')
+                {
+                    continue;
+                }
+
+                if (svLine.front() == '[')
+                {
+                    const size_t nClose = svLine.find(']');
+                    if (nClose != std::string_view::npos)
+                    {
+                        svSection = Trim(svLine.substr(1, nClose - 1));
+                        pKeys = &m_mapSections[svSection];
+                    }
+                    continue;
+                }
+
+                const size_t nEqual = svLine.find('=');
+                if (nEqual == std::string_view::npos)
+                {
+                    continue;
+                }
+
+                Entry entry{ svSection, Trim(svLine.substr(0, nEqual)), Trim(svLine.substr(nEqual + 1)) };
+                if (pKeys->emplace(entry.svKey, m_vEntries.size()).second)
+                {
+                    m_vEntries.push_back(entry);
+                }
+            }
+        }
+
+        /**
+        * @brief        색인 없이 줄을 나누기만 하는 함수 (키 줄 수 반환)
+        */
+        static size_t Tokenize(std::string_view svText)
+        {
+            size_t nKeyCount = 0;
+            const char* pCur = svText.data();
+            const char* pEnd = pCur + svText.size();
+            while (pCur < pEnd)
+            {
+                const char* pLineEnd = static_cast<const char*>(::memchr(pCur, '\n', pEnd - pCur));
+                if (pLineEnd == nullptr)
+                {
+                    pLineEnd = pEnd;
+                }
+                std::string_view svLine = Trim(std::string_view(pCur, pLineEnd - pCur));
+                pCur = pLineEnd + 1;
+                if (!svLine.empty() &&
+                    svLine.front() != ';' && svLine.front() != '#' && svLine.front() != '[' &&
+                    svLine.find('=') != std::string_view::npos)
+                {
+                    ++nKeyCount;
+                }
+            }
+            return nKeyCount;
+        }
+
+        size_t GetKeyCount() const noexcept
+        {
+            return m_vEntries.size();
+        }
+
+    private:
+        using KeyIndex = std::unordered_map<std::string_view, size_t>;
+
+        struct Entry
+        {
+            std::string_view svSection;
+            std::string_view svKey;
+            std::string_view svValue;
+        };
+
+        static std::string_view Trim(std::string_view svText) noexcept
+        {
+            while (!svText.empty() && (svText.front() == ' ' || svText.front() == '\t' || svText.front() == '\r'))
+            {
+                svText.remove_prefix(1);
+            }
+            while (!svText.empty() && (svText.back() == ' ' || svText.back() == '\t' || svText.back() == '\r'))
+            {
+                svText.remove_suffix(1);
+            }
+            return svText;
+        }
+
+        std::vector<char> m_vBuffer;
+        std::unordered_map<std::string_view, KeyIndex> m_mapSections;
+        std::vector<Entry> m_vEntries;
+    };
+
+    /**
+    * @brief        주석, 빈 줄, 따옴표 값, 긴 값이 섞인 INI 텍스트 생성
+    */
+    std::string MakeIniText(int nSectionCount, int nKeyCount)
+    {
+        std::string strText;
+        strText.reserve(static_cast<size_t>(nSectionCount) * nKeyCount * 48);
+        for (int nSection = 0; nSection < nSectionCount; ++nSection)
+        {
+            strText += "; section " + std::to_string(nSection) + "\r\n[Section" + std::to_string(nSection) + "]\r\n";
+            for (int nKey = 0; nKey < nKeyCount; ++nKey)
+            {
+                strText += "Key" + std::to_string(nKey) + " = ";
+                switch (nKey % 4)
+                {
+                case 0:
+                    strText += std::to_string(nSection * nKeyCount + nKey);
+                    break;
+                case 1:
+                    strText += "\"quoted value ; with = signs\"";
+                    break;
+                case 2:
+                    strText += "C:\\Program Files\\EskUtil\\config\\path" + std::to_string(nKey) + ".ini";
+                    break;
+                default:
+                    strText += "true";
+                    break;
+                }
+                strText += "\r\n";
+            }
+            strText += "\r\n";
+        }
+        return strText;
+    }
+
+    /**
+    * @brief        func를 REPEAT_COUNT번 실행한 중 가장 빠른 시간 (초)
+    */
+    template <typename Func>
+    double MeasureBest(Func func)
+    {
+        double dBest = 1e30;
+        for (int i = 0; i < REPEAT_COUNT; ++i)
+        {
+            const uint64_t nStart = time::GetMonotonicNanos();
+            func();
+            const double dElapsed = static_cast<double>(time::GetMonotonicNanos() - nStart) / 1e9;
+            dBest = dElapsed < dBest ? dElapsed : dBest;
+        }
+        return dBest;
+    }
+
+    void PrintResult(const char* pszName, size_t nBytes, double dSeconds, size_t nKeyCount)
+    {
+        std::printf("%-28s: %8.2f ms  %6.2f GB/s  (%zu keys)\n", pszName, dSeconds * 1e3, static_cast<double>(nBytes) / dSeconds / 1e9, nKeyCount);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int nSectionCount = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const int nKeyCount = argc > 2 ? std::atoi(argv[2]) : 200;
+    const std::string strText = MakeIniText(nSectionCount, nKeyCount);
+    std::printf("INI text: %.1f MB, %d sections x %d keys\n", static_cast<double>(strText.size()) / 1e6, nSectionCount, nKeyCount);
+
+    size_t nTokenKeys = 0;
+    const double dTokenize = MeasureBest([&]() { nTokenKeys = BaselineIni::Tokenize(strText); });
+    PrintResult("baseline tokenize only", strText.size(), dTokenize, nTokenKeys);
+
+    BaselineIni baseline;
+    const double dBaseline = MeasureBest([&]() { baseline.LoadText(strText); });
+    PrintResult("baseline parse + index", strText.size(), dBaseline, baseline.GetKeyCount());
+
+    ini::IniDocument doc;
+    const double dDocument = MeasureBest([&]() { doc.LoadText(strText); });
+    PrintResult("IniDocument parse + index", strText.size(), dDocument, doc.GetKeyCount());
+
+    std::printf("speedup (parse + index)     : x%.2f\n", dBaseline / dDocument);
+    return baseline.GetKeyCount() == doc.GetKeyCount() ? 0 : 1;
+}
\ No newline at end of file
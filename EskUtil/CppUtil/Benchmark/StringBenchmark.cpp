@@ -0,0 +1,153 @@
+﻿/**
+* @file			StringBenchmark.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		Split / Find SIMD 경로와 스칼라 구현 비교 벤치마크 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		Split은 한 글자씩 구분자를 검사하는 구현과, Find는 std::string_view::find와 비교한다.
+*				SIMD 경로는 ESK_SIMD_AVX2/NEON이 정의될 때만 쓰이므로 AVX2 옵션 없이 빌드하면 라이브러리의 스칼라 경로를 잰다.
+*				빌드 예)
+*				cl /std:c++20 /O2 /arch:AVX2 /EHsc /I.. StringBenchmark.cpp
+*				cl /std:c++20 /O2 /EHsc /I.. StringBenchmark.cpp             (스칼라 경로)
+*/
+
+#include "String.h"
+#include "Time.h"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    constexpr size_t TEXT_SIZE = static_cast<size_t>(16) << 20;
+    constexpr int REPEAT_COUNT = 10;
+
+    /**
+    * @brief        func를 REPEAT_COUNT번 실행한 중 가장 빠른 시간 (초)
+    */
+    template <typename Func>
+    double MeasureBest(Func func)
+    {
+        double dBest = 1e30;
+        for (int i = 0; i < REPEAT_COUNT; ++i)
+        {
+            const uint64_t nStart = time::GetMonotonicNanos();
+            func();
+            const double dElapsed = static_cast<double>(time::GetMonotonicNanos() - nStart) / 1e9;
+            dBest = dElapsed < dBest ? dElapsed : dBest;
+        }
+        return dBest;
+    }
+
+    /**
+    * @brief        평균 nWordLength 글자 단어를 구분자로 이은 텍스트
+    */
+    std::string MakeText(size_t nWordLength)
+    {
+        std::mt19937 rng(42);
+        constexpr std::string_view LETTERS = "abcdefghijklmnopqrstuvwxyz0123456789";
+        constexpr std::string_view DELIMS = ",;\t ";
+        std::string strText;
+        strText.reserve(TEXT_SIZE);
+        while (strText.size() < TEXT_SIZE)
+        {
+            const size_t nLength = 1 + rng() % (nWordLength * 2 - 1);
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                strText += LETTERS[rng() % LETTERS.size()];
+            }
+            strText += DELIMS[rng() % DELIMS.size()];
+        }
+        return strText;
+    }
+
+    /**
+    * @brief        한 글자씩 구분자를 검사하는 Split (비교 기준, str::Split과 같은 결과)
+    */
+    size_t SplitScalar(std::string_view svText, std::string_view svDelims, std::string_view* pOut, size_t nMaxCount)
+    {
+        bool arrIsDelim[256] = {};
+        for (char ch : svDelims)
+        {
+            arrIsDelim[static_cast<uint8_t>(ch)] = true;
+        }
+        size_t nCount = 0;
+        size_t nStart = 0;
+        for (size_t i = 0; i < svText.size() && nCount + 1 < nMaxCount; ++i)
+        {
+            if (arrIsDelim[static_cast<uint8_t>(svText[i])])
+            {
+                pOut[nCount++] = svText.substr(nStart, i - nStart);
+                nStart = i + 1;
+            }
+        }
+        pOut[nCount++] = svText.substr(nStart);
+        return nCount;
+    }
+
+    void PrintResult(const char* pszName, double dScalar, double dLibrary)
+    {
+        std::printf("%-34s: scalar %6.2f GB/s  str:: %6.2f GB/s  (x%.2f)\n", pszName,
+            TEXT_SIZE / dScalar / 1e9, TEXT_SIZE / dLibrary / 1e9, dScalar / dLibrary);
+    }
+
+    void RunSplit(size_t nWordLength, std::string_view svDelims)
+    {
+        const std::string strText = MakeText(nWordLength);
+        std::vector<std::string_view> vOut(strText.size() + 1);
+        size_t nScalarCount = 0;
+        size_t nLibraryCount = 0;
+        const double dScalar = MeasureBest([&]() { nScalarCount = SplitScalar(strText, svDelims, vOut.data(), vOut.size()); });
+        const double dLibrary = MeasureBest([&]() { nLibraryCount = str::Split(strText, svDelims, vOut.data(), vOut.size()); });
+
+        char szName[64];
+        std::snprintf(szName, sizeof(szName), "Split (word %zu, %zu delims)", nWordLength, svDelims.size());
+        PrintResult(szName, dScalar, dLibrary);
+        if (nScalarCount != nLibraryCount)
+        {
+            std::printf("  MISMATCH: %zu tokens vs %zu\n", nScalarCount, nLibraryCount);
+        }
+    }
+
+    void RunFind(std::string_view svPattern)
+    {
+        const std::string strText = MakeText(8);
+        size_t nScalarPos = 0;
+        size_t nLibraryPos = 0;
+        const double dScalar = MeasureBest([&]() { nScalarPos = std::string_view(strText).find(svPattern); });
+        const double dLibrary = MeasureBest([&]() { nLibraryPos = str::Find(strText, svPattern); });
+
+        char szName[64];
+        std::snprintf(szName, sizeof(szName), "Find (\"%.*s\")", static_cast<int>(svPattern.size()), svPattern.data());
+        PrintResult(szName, dScalar, dLibrary);
+        if (nScalarPos != nLibraryPos)
+        {
+            std::printf("  MISMATCH: %zu vs %zu\n", nScalarPos, nLibraryPos);
+        }
+    }
+}
+
+int main()
+{
+#if defined(ESK_SIMD_AVX2)
+    std::printf("str:: path: AVX2\n");
+#elif defined(ESK_SIMD_NEON)
+    std::printf("str:: path: NEON\n");
+#else
+    std::printf("str:: path: scalar\n");
+#endif
+    RunSplit(4, ",");
+    RunSplit(16, ",");
+    RunSplit(16, ",;\t ");
+    RunSplit(16, ",;\t |:/-=");
+
+    // 텍스트에 없는 패턴 (전체 탐색), 첫 글자가 흔한 패턴
+    RunFind("needle");
+    RunFind("a#b");
+    RunFind("0123456789abcdef");
+    return 0;
+}
\ No newline at end of file
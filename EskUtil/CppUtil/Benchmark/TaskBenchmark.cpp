@@ -0,0 +1,121 @@
+﻿/**
+* @file			TaskBenchmark.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		ThreadPool 처리량 벤치마크 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		빌드 예)
+*				g++ -std=c++20 -O2 -pthread -I.. TaskBenchmark.cpp -o TaskBenchmark
+*				cl /std:c++20 /O2 /EHsc /I.. TaskBenchmark.cpp
+*				실행: TaskBenchmark [스레드 수 (0: 코어 수)]
+*/
+
+#include "Task.h"
+#include "Time.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    double GetSeconds() noexcept
+    {
+        return static_cast<double>(time::GetMonotonicNanos()) / 1e9;
+    }
+
+    /**
+    * @brief        작업 하나가 덧셈 한 번뿐인 피보나치 (작업당 오버헤드 측정용)
+    */
+    int64_t FineFib(task::ThreadPool& pool, int n)
+    {
+        if (n < 2)
+        {
+            return n;
+        }
+        task::Future<int64_t> future = pool.Async([&pool, n] { return FineFib(pool, n - 1); });
+        const int64_t nRight = FineFib(pool, n - 2);
+        return future.Get() + nRight;
+    }
+
+    /**
+    * @brief        외부 스레드에서 빈 작업을 nCount개 넣고 모두 끝날 때까지의 처리량
+    */
+    void RunExternalSubmit(task::ThreadPool& pool, int nCount)
+    {
+        std::atomic<int> nLeft{ nCount };
+        const double dStart = GetSeconds();
+        for (int i = 0; i < nCount; ++i)
+        {
+            pool.Submit([&nLeft] { nLeft.fetch_sub(1, std::memory_order_relaxed); });
+        }
+        while (nLeft.load(std::memory_order_acquire) != 0)
+        {
+            pool.TryRunOne();
+        }
+        const double dElapsed = GetSeconds() - dStart;
+        std::printf("external submit : %6.2f Mtask/s (%4.0f ns/task)\n", nCount / dElapsed / 1e6, dElapsed * 1e9 / nCount);
+    }
+
+    /**
+    * @brief        워커 안에서 빈 작업을 nCount개 넣는 경우의 처리량 (로컬 큐 + 훔치기 경로)
+    */
+    void RunWorkerSpawn(task::ThreadPool& pool, int nCount)
+    {
+        std::atomic<int> nLeft{ nCount };
+        const double dStart = GetSeconds();
+        pool.Submit([&pool, &nLeft, nCount]
+            {
+                for (int i = 0; i < nCount; ++i)
+                {
+                    pool.Submit([&nLeft] { nLeft.fetch_sub(1, std::memory_order_relaxed); });
+                }
+            });
+        while (nLeft.load(std::memory_order_acquire) != 0)
+        {
+            pool.TryRunOne();
+        }
+        const double dElapsed = GetSeconds() - dStart;
+        std::printf("worker spawn    : %6.2f Mtask/s (%4.0f ns/task)\n", nCount / dElapsed / 1e6, dElapsed * 1e9 / nCount);
+    }
+
+    /**
+    * @brief        Future를 기다리는 중첩 작업의 처리량 (FineFib(25)는 Async 작업 121392개 생성)
+    */
+    void RunFineFib(task::ThreadPool& pool)
+    {
+        constexpr int TASK_COUNT = 121392;
+        const double dStart = GetSeconds();
+        const int64_t nResult = FineFib(pool, 25);
+        const double dElapsed = GetSeconds() - dStart;
+        std::printf("fine fib(25)    : %lld, %.3f s (%4.0f ns/task)\n", static_cast<long long>(nResult), dElapsed, dElapsed * 1e9 / TASK_COUNT);
+    }
+
+    /**
+    * @brief        16M개 float에 대한 ParallelFor 시간
+    */
+    void RunParallelFor(task::ThreadPool& pool)
+    {
+        std::vector<float> vData(static_cast<size_t>(1) << 24, 1.0f);
+        const double dStart = GetSeconds();
+        pool.ParallelFor(0, vData.size(), [&vData](size_t i) { vData[i] = vData[i] * 2.0f + 1.0f; });
+        const double dElapsed = GetSeconds() - dStart;
+        std::printf("parallel for 16M: %.1f ms\n", dElapsed * 1e3);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t nThreadCount = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 0;
+    task::ThreadPool pool(nThreadCount);
+    std::printf("threads         : %zu\n", pool.GetThreadCount());
+
+    RunExternalSubmit(pool, 1000000);
+    RunWorkerSpawn(pool, 1000000);
+    RunFineFib(pool);
+    RunParallelFor(pool);
+    return 0;
+}
\ No newline at end of file
@@ -1,56 +1,585 @@
 ﻿/**
 * @file			Calculate.h
 * @author		yc.jeon (Eskeptor)
-* @date			2026-04-21
-* @version		0.0.3
+* @date			2026-10-18
+* @version		0.0.4
 * @brief		Calculate Utility
 */
 
 #pragma once
 #include "Common.h"
 
+#include <algorithm>
+#include <bit>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
 
 namespace esk::gearforge::util::calc
 {
+    namespace detail
+    {
+        /**
+        * @brief        32비트 정수 나눗셈에 사용할 역수(Magic Number) 정보
+        */
+        struct DivMagic32
+        {
+            uint32_t nMagic;        // 역수 (2^nShift / |제수| 의 올림값)
+            int nShift;             // 곱셈 후 우측 시프트 횟수
+            bool bNegative;         // 제수가 음수인지 유무
+        };
+        /**
+        * @brief        64비트 정수 나눗셈에 사용할 역수(Magic Number) 정보
+        */
+        struct DivMagic64
+        {
+            uint64_t nMagic;        // 역수 (2^(64 + nShift) / |제수| 의 올림값)
+            int nShift;             // 상위 64비트를 취한 후 우측 시프트 횟수 (-1: 제수의 절대값이 1)
+            bool bNegative;         // 제수가 음수인지 유무
+        };
+
+        /**
+        * @brief        부호 있는 정수의 절대값을 부호 없는 정수로 반환하는 함수 (최소값도 overflow 없음)
+        */
+        constexpr uint64_t AbsToUnsigned(int64_t nValue) noexcept
+        {
+            return nValue < 0 ? 0 - static_cast<uint64_t>(nValue) : static_cast<uint64_t>(nValue);
+        }
+        /**
+        * @brief        2^l >= nValue 를 만족하는 최소 l을 반환하는 함수
+        */
+        constexpr int CeilLog2(uint64_t nValue) noexcept
+        {
+            int nLog = 0;
+            while (nLog < 64 && (uint64_t(1) << nLog) < nValue)
+            {
+                ++nLog;
+            }
+            return nLog;
+        }
+        /**
+        * @brief        2^nPow / nDivisor 의 올림값을 구하는 함수 (nPow <= 127, 결과는 64비트 이내여야 함)
+        */
+        constexpr uint64_t CeilDivPow2(int nPow, uint64_t nDivisor) noexcept
+        {
+            uint64_t nQuot = 0;
+            uint64_t nRem = 0;
+            for (int i = nPow; i >= 0; --i)
+            {
+                // nRem < nDivisor <= 2^63 이므로 시프트 시 overflow 없음
+                nRem = (nRem << 1) | (i == nPow ? 1 : 0);
+                nQuot <<= 1;
+                if (nRem >= nDivisor)
+                {
+                    nRem -= nDivisor;
+                    nQuot |= 1;
+                }
+            }
+            return nRem != 0 ? nQuot + 1 : nQuot;
+        }
+        /**
+        * @brief        64비트 x 64비트 곱셈의 상위 64비트를 반환하는 함수
+        */
+        constexpr uint64_t MulHiU64(uint64_t nA, uint64_t nB) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(nA) * nB) >> 64);
+#else
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            if (!std::is_constant_evaluated())
+            {
+                return __umulh(nA, nB);
+            }
+    #endif
+            uint64_t nALo = nA & 0xFFFFFFFF;
+            uint64_t nAHi = nA >> 32;
+            uint64_t nBLo = nB & 0xFFFFFFFF;
+            uint64_t nBHi = nB >> 32;
+            uint64_t nLoLo = nALo * nBLo;
+            uint64_t nHiLo = nAHi * nBLo;
+            uint64_t nLoHi = nALo * nBHi;
+            uint64_t nCross = (nLoLo >> 32) + (nHiLo & 0xFFFFFFFF) + nLoHi;
+            return nAHi * nBHi + (nHiLo >> 32) + (nCross >> 32);
+#endif
+        }
+        /**
+        * @brief        32비트 나눗셈용 역수를 계산하는 함수
+        * @details      l = ceil(log2|d|), m = ceil(2^(31 + l) / |d|) 로 두면
+        *               |n| <= 2^31 인 모든 입력에 대해 floor(|n| * m / 2^(31 + l)) == floor(|n| / |d|) 가 성립함
+        *               (m < 2^32 이므로 곱셈은 64비트 내에서 끝남)
+        */
+        constexpr DivMagic32 MakeDivMagic32(int64_t nDivisor) noexcept
+        {
+            uint64_t nAbs = AbsToUnsigned(nDivisor);
+            if (nAbs > (uint64_t(1) << 31))
+            {
+                // 32비트 입력으로는 몫이 항상 0
+                return DivMagic32{ 0, 32, nDivisor < 0 };
+            }
+            int nLog = CeilLog2(nAbs);
+            return DivMagic32{ static_cast<uint32_t>(CeilDivPow2(31 + nLog, nAbs)), 31 + nLog, nDivisor < 0 };
+        }
+        /**
+        * @brief        64비트 나눗셈용 역수를 계산하는 함수
+        * @details      l = ceil(log2|d|), m = ceil(2^(63 + l) / |d|) 로 두고 128비트 곱의 상위 64비트를 (l - 1)만큼 시프트함
+        */
+        constexpr DivMagic64 MakeDivMagic64(int64_t nDivisor) noexcept
+        {
+            uint64_t nAbs = AbsToUnsigned(nDivisor);
+            if (nAbs == 1)
+            {
+                return DivMagic64{ 0, -1, nDivisor < 0 };
+            }
+            int nLog = CeilLog2(nAbs);
+            return DivMagic64{ CeilDivPow2(63 + nLog, nAbs), nLog - 1, nDivisor < 0 };
+        }
+        /**
+        * @brief        역수 곱셈으로 32비트 나눗셈을 수행하는 함수 (0 방향 버림, '/' 연산과 동일)
+        */
+        constexpr int32_t DivByMagic(int32_t nDiv, const DivMagic32& magic) noexcept
+        {
+            // 부호 처리는 마스크 연산으로 (제수가 상수면 GCC가 삼항 연산자를 분기로 만들어 부호가 섞인 입력에서 '/'보다 느려짐)
+            const uint32_t nSign = static_cast<uint32_t>(nDiv >> 31);
+            const uint64_t nAbs = (static_cast<uint32_t>(nDiv) ^ nSign) - nSign;
+            const uint32_t nQuot = static_cast<uint32_t>((nAbs * magic.nMagic) >> magic.nShift);
+            const uint32_t nQuotSign = nSign ^ (0u - static_cast<uint32_t>(magic.bNegative));
+            return static_cast<int32_t>((nQuot ^ nQuotSign) - nQuotSign);
+        }
+        /**
+        * @brief        역수 곱셈으로 64비트 나눗셈을 수행하는 함수 (0 방향 버림, '/' 연산과 동일)
+        */
+        constexpr int64_t DivByMagic(int64_t nDiv, const DivMagic64& magic) noexcept
+        {
+            const uint64_t nSign = static_cast<uint64_t>(nDiv >> 63);
+            const uint64_t nAbs = (static_cast<uint64_t>(nDiv) ^ nSign) - nSign;
+            const uint64_t nQuot = magic.nShift < 0 ? nAbs : (MulHiU64(nAbs, magic.nMagic) >> magic.nShift);
+            const uint64_t nQuotSign = nSign ^ (0ull - static_cast<uint64_t>(magic.bNegative));
+            return static_cast<int64_t>((nQuot ^ nQuotSign) - nQuotSign);
+        }
+        /**
+        * @brief        역수 곱셈으로 32비트 배열을 나누는 함수 (AVX2/NEON 사용 가능 시 벡터 연산)
+        * @param[in]    pSrc            나눌 데이터 배열
+        * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        * @param[in]    magic           제수의 역수 정보
+        */
+        inline void DivBatchByMagic(const int32_t* pSrc, int32_t* pDst, size_t nCount, const DivMagic32& magic) noexcept
+        {
+            size_t i = 0;
+#if defined(ESK_SIMD_AVX2)
+            const __m256i vMagic = _mm256_set1_epi64x(magic.nMagic);
+            const __m128i vShift = _mm_cvtsi32_si128(magic.nShift);
+            const __m256i vDivSign = _mm256_set1_epi32(magic.bNegative ? -1 : 0);
+            // i + 8 <= nCount로 쓰면 상수 길이로 인라인될 때 GCC가 꼬리 루프에 -Waggressive-loop-optimizations 오경고를 냄
+            for (; i < (nCount & ~static_cast<size_t>(7)); i += 8)
+            {
+                __m256i vSrc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+                // abs(INT32_MIN)은 부호 없는 값 2^31로 해석되므로 그대로 사용 가능
+                __m256i vAbs = _mm256_abs_epi32(vSrc);
+                __m256i vEven = _mm256_srl_epi64(_mm256_mul_epu32(vAbs, vMagic), vShift);
+                __m256i vOdd = _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(vAbs, 32), vMagic), vShift);
+                __m256i vQuot = _mm256_blend_epi32(vEven, _mm256_slli_epi64(vOdd, 32), 0xAA);
+                __m256i vSign = _mm256_xor_si256(_mm256_srai_epi32(vSrc, 31), vDivSign);
+                vQuot = _mm256_sub_epi32(_mm256_xor_si256(vQuot, vSign), vSign);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), vQuot);
+            }
+#elif defined(ESK_SIMD_NEON)
+            const uint32x2_t vMagic = vdup_n_u32(magic.nMagic);
+            const int64x2_t vShift = vdupq_n_s64(-magic.nShift);
+            const int32x4_t vDivSign = vdupq_n_s32(magic.bNegative ? -1 : 0);
+            for (; i < (nCount & ~static_cast<size_t>(3)); i += 4)
+            {
+                int32x4_t vSrc = vld1q_s32(pSrc + i);
+                uint32x4_t vAbs = vreinterpretq_u32_s32(vabsq_s32(vSrc));
+                uint64x2_t vLo = vshlq_u64(vmull_u32(vget_low_u32(vAbs), vMagic), vShift);
+                uint64x2_t vHi = vshlq_u64(vmull_u32(vget_high_u32(vAbs), vMagic), vShift);
+                int32x4_t vQuot = vreinterpretq_s32_u32(vcombine_u32(vmovn_u64(vLo), vmovn_u64(vHi)));
+                int32x4_t vSign = veorq_s32(vshrq_n_s32(vSrc, 31), vDivSign);
+                vQuot = vsubq_s32(veorq_s32(vQuot, vSign), vSign);
+                vst1q_s32(pDst + i, vQuot);
+            }
+#endif
+            for (; i < nCount; ++i)
+            {
+                pDst[i] = DivByMagic(pSrc[i], magic);
+            }
+        }
+        /**
+        * @brief        부호 없는 정수 나눗셈에 사용할 역수(Magic Number) 정보
+        * @details      t = mulhi(n, nMagic), q = (t + ((n - t) >> nShift1)) >> nShift2
+        */
+        struct DivMagicU
+        {
+            uint64_t nMagic;        // 역수 (2^N * (2^l - d) / d 의 내림값 + 1)
+            int nShift1;            // 1차 시프트 (l > 0 이면 1)
+            int nShift2;            // 2차 시프트 (l - 1)
+        };
+        /**
+        * @brief        (nHigh * 2^64 + nLow) / nDivisor 의 몫을 구하는 함수 (nHigh < nDivisor 여야 함)
+        */
+        constexpr uint64_t DivWide(uint64_t nHigh, uint64_t nLow, uint64_t nDivisor) noexcept
+        {
+            uint64_t nRem = nHigh;
+            uint64_t nQuot = 0;
+            for (int i = 0; i < 64; ++i)
+            {
+                // nRem의 최상위 비트가 밀려나는 경우에도 실제 값은 nDivisor 이상이므로 뺄셈 결과는 정확함
+                bool bCarry = (nRem >> 63) != 0;
+                nRem = (nRem << 1) | (nLow >> 63);
+                nLow <<= 1;
+                nQuot <<= 1;
+                if (bCarry || nRem >= nDivisor)
+                {
+                    nRem -= nDivisor;
+                    nQuot |= 1;
+                }
+            }
+            return nQuot;
+        }
+        /**
+        * @brief        부호 없는 정수 나눗셈용 역수를 계산하는 함수 (Granlund-Montgomery)
+        * @tparam       T               uint32_t 또는 uint64_t
+        */
+        template <typename T>
+        constexpr DivMagicU MakeDivMagicU(T nDivisor) noexcept
+        {
+            int nLog = CeilLog2(nDivisor);
+            uint64_t nMagic = 0;
+            if constexpr (sizeof(T) == 4)
+            {
+                uint64_t nDiff = (uint64_t(1) << nLog) - nDivisor;
+                nMagic = ((nDiff << 32) / nDivisor) + 1;
+            }
+            else
+            {
+                // nLog == 64 인 경우 2^64 - d 는 0 - d 와 같음
+                uint64_t nDiff = (nLog < 64 ? (uint64_t(1) << nLog) : 0) - nDivisor;
+                nMagic = DivWide(nDiff, 0, nDivisor) + 1;
+            }
+            return DivMagicU{ nMagic, nLog > 0 ? 1 : 0, nLog > 0 ? nLog - 1 : 0 };
+        }
+        /**
+        * @brief        역수 곱셈으로 부호 없는 나눗셈을 수행하는 함수
+        */
+        template <typename T>
+        constexpr T DivByMagicU(T nDiv, const DivMagicU& magic) noexcept
+        {
+            T nHigh = 0;
+            if constexpr (sizeof(T) == 4)
+            {
+                nHigh = static_cast<T>((static_cast<uint64_t>(nDiv) * magic.nMagic) >> 32);
+            }
+            else
+            {
+                nHigh = MulHiU64(nDiv, magic.nMagic);
+            }
+            return (nHigh + ((nDiv - nHigh) >> magic.nShift1)) >> magic.nShift2;
+        }
+        /**
+        * @brief        역수 곱셈으로 부호 없는 32비트 배열을 나누는 함수 (AVX2/NEON 사용 가능 시 벡터 연산)
+        * @param[in]    pSrc            나눌 데이터 배열
+        * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        * @param[in]    magic           제수의 역수 정보
+        */
+        inline void DivBatchByMagicU(const uint32_t* pSrc, uint32_t* pDst, size_t nCount, const DivMagicU& magic) noexcept
+        {
+            size_t i = 0;
+#if defined(ESK_SIMD_AVX2)
+            const __m256i vMagic = _mm256_set1_epi64x(static_cast<int64_t>(magic.nMagic));
+            const __m128i vShift1 = _mm_cvtsi32_si128(magic.nShift1);
+            const __m128i vShift2 = _mm_cvtsi32_si128(magic.nShift2);
+            for (; i < (nCount & ~static_cast<size_t>(7)); i += 8)
+            {
+                __m256i vSrc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+                __m256i vEven = _mm256_srli_epi64(_mm256_mul_epu32(vSrc, vMagic), 32);
+                __m256i vOdd = _mm256_mul_epu32(_mm256_srli_epi64(vSrc, 32), vMagic);
+                __m256i vHigh = _mm256_blend_epi32(vEven, vOdd, 0xAA);
+                __m256i vQuot = _mm256_srl_epi32(_mm256_add_epi32(vHigh, _mm256_srl_epi32(_mm256_sub_epi32(vSrc, vHigh), vShift1)), vShift2);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), vQuot);
+            }
+#elif defined(ESK_SIMD_NEON)
+            const uint32x2_t vMagic = vdup_n_u32(static_cast<uint32_t>(magic.nMagic));
+            const int32x4_t vShift1 = vdupq_n_s32(-magic.nShift1);
+            const int32x4_t vShift2 = vdupq_n_s32(-magic.nShift2);
+            for (; i < (nCount & ~static_cast<size_t>(3)); i += 4)
+            {
+                uint32x4_t vSrc = vld1q_u32(pSrc + i);
+                uint32x2_t vLo = vshrn_n_u64(vmull_u32(vget_low_u32(vSrc), vMagic), 32);
+                uint32x2_t vHi = vshrn_n_u64(vmull_u32(vget_high_u32(vSrc), vMagic), 32);
+                uint32x4_t vHigh = vcombine_u32(vLo, vHi);
+                uint32x4_t vQuot = vshlq_u32(vaddq_u32(vHigh, vshlq_u32(vsubq_u32(vSrc, vHigh), vShift1)), vShift2);
+                vst1q_u32(pDst + i, vQuot);
+            }
+#endif
+            for (; i < nCount; ++i)
+            {
+                pDst[i] = DivByMagicU(pSrc[i], magic);
+            }
+        }
+    } // namespace detail
+
+    /**
+    * @brief        컴파일 타임에 역수를 계산하여 상수 N으로 나누는 클래스
+    * @details      모든 int32_t / int64_t 입력에 대해 '/' 연산과 동일한 결과 (0 방향 버림)
+    * @tparam       N               제수 (0 불가, 음수 가능)
+    */
+    template <int64_t N>
+    struct DivConst
+    {
+        static_assert(N != 0, "0으로 나눌 수 없음");
+
+        static constexpr detail::DivMagic32 Magic32 = detail::MakeDivMagic32(N);
+        static constexpr detail::DivMagic64 Magic64 = detail::MakeDivMagic64(N);
+
+        /**
+        * @brief        N으로 나누는 함수
+        * @param[in]    nDiv            N으로 나눌 데이터
+        * @return       N으로 나눈 결과값 (정수)
+        */
+        static constexpr int32_t Div(int32_t nDiv) noexcept
+        {
+            return detail::DivByMagic(nDiv, Magic32);
+        }
+        /**
+        * @brief        N으로 나누는 함수
+        * @param[in]    nDiv            N으로 나눌 데이터
+        * @return       N으로 나눈 결과값 (정수)
+        */
+        static constexpr int64_t Div(int64_t nDiv) noexcept
+        {
+            return detail::DivByMagic(nDiv, Magic64);
+        }
+        /**
+        * @brief        배열의 모든 데이터를 N으로 나누는 함수
+        * @param[in]    pSrc            N으로 나눌 데이터 배열
+        * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        */
+        static void Div(const int32_t* pSrc, int32_t* pDst, size_t nCount) noexcept
+        {
+            detail::DivBatchByMagic(pSrc, pDst, nCount, Magic32);
+        }
+        /**
+        * @brief        배열의 모든 데이터를 N으로 나누는 함수 (64비트는 벡터 곱셈 명령이 없어 스칼라 연산)
+        * @param[in]    pSrc            N으로 나눌 데이터 배열
+        * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        */
+        static void Div(const int64_t* pSrc, int64_t* pDst, size_t nCount) noexcept
+        {
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                pDst[i] = detail::DivByMagic(pSrc[i], Magic64);
+            }
+        }
+    };
+
+    namespace detail
+    {
+        /**
+        * @brief        int32_t 경계값(최소/최대, 0 근처, N의 배수 전후)에서 DivConst<N>이 '/'와 같은지 검사 (컴파일 타임)
+        * @details      전체 32비트 범위 검사는 Verify/DivConstVerify.cpp
+        */
+        template <int64_t N>
+        constexpr bool IsDivConstExactAtBoundary() noexcept
+        {
+            constexpr int64_t MIN = (std::numeric_limits<int32_t>::min)();
+            constexpr int64_t MAX = (std::numeric_limits<int32_t>::max)();
+            constexpr int64_t TOP = MAX / N * N;
+            constexpr int64_t BOTTOM = MIN / N * N;
+            constexpr int64_t VALUES[] = { MIN, MIN + 1, MAX, MAX - 1, 0, 1, -1, N - 1, N, N + 1, 1 - N, -N, -N - 1,
+                TOP - 1, TOP, TOP + 1, BOTTOM - 1, BOTTOM, BOTTOM + 1 };
+            for (int64_t nValue : VALUES)
+            {
+                if (nValue < MIN || nValue > MAX)
+                {
+                    continue;
+                }
+                const int32_t nDiv = static_cast<int32_t>(nValue);
+                if (DivConst<N>::Div(nDiv) != nDiv / N)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace detail
+
+    static_assert(detail::IsDivConstExactAtBoundary<10>(), "DivConst<10> 경계값 오류");
+    static_assert(detail::IsDivConstExactAtBoundary<100>(), "DivConst<100> 경계값 오류");
+    static_assert(detail::IsDivConstExactAtBoundary<1000>(), "DivConst<1000> 경계값 오류");
+
     /**
     * @brief        10으로 나누는 함수
     * @param[in]    nDiv            10으로 나눌 데이터
     * @return       10으로 나눈 결과값 (정수)
     */
-    inline int32_t Div10(int32_t nDiv) noexcept
+    constexpr int32_t Div10(int32_t nDiv) noexcept
     {
-        int64_t nDivisor = 0x1999999A;    // 10의 역수
-        int32_t nResult = static_cast<int32_t>(((nDivisor * nDiv) >> 32));
-        int32_t nReq = nDiv - nResult * 10;
-        return (nDiv < 0 && nReq != 0) ? nResult + 1 : nResult;
+        return DivConst<10>::Div(nDiv);
     }
     /**
     * @brief        100으로 나누는 함수
     * @param[in]    nDiv            100으로 나눌 데이터
     * @return       100으로 나눈 결과값 (정수)
     */
-    inline int32_t Div100(int32_t nDiv) noexcept
+    constexpr int32_t Div100(int32_t nDiv) noexcept
     {
-        int64_t nDivisor = 0x028F5C29;    // 100의 역수
-        int32_t nResult = static_cast<int32_t>(((nDivisor * nDiv) >> 32));
-        int32_t nReq = nDiv - nResult * 100;
-        return (nDiv < 0 && nReq != 0) ? nResult + 1 : nResult;
+        return DivConst<100>::Div(nDiv);
     }
     /**
     * @brief        1000으로 나누는 함수
     * @param[in]    nDiv            1000으로 나눌 데이터
     * @return       1000으로 나눈 결과값 (정수)
     */
-    inline int32_t Div1000(int32_t nDiv) noexcept
+    constexpr int32_t Div1000(int32_t nDiv) noexcept
     {
-        int64_t nDivisor = 0x00418937;    // 1000의 역수
-        int32_t nResult = static_cast<int32_t>(((nDivisor * nDiv) >> 32));
-        int32_t nReq = nDiv - nResult * 1000;
-        return (nDiv < 0 && nReq != 0) ? nResult + 1 : nResult;
+        return DivConst<1000>::Div(nDiv);
     }
     /**
+    * @brief        배열의 모든 데이터를 10으로 나누는 함수
+    * @param[in]    pSrc            10으로 나눌 데이터 배열
+    * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+    * @param[in]    nCount          배열의 길이
+    */
+    inline void Div10(const int32_t* pSrc, int32_t* pDst, size_t nCount) noexcept
+    {
+        DivConst<10>::Div(pSrc, pDst, nCount);
+    }
+    /**
+    * @brief        배열의 모든 데이터를 100으로 나누는 함수
+    * @param[in]    pSrc            100으로 나눌 데이터 배열
+    * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+    * @param[in]    nCount          배열의 길이
+    */
+    inline void Div100(const int32_t* pSrc, int32_t* pDst, size_t nCount) noexcept
+    {
+        DivConst<100>::Div(pSrc, pDst, nCount);
+    }
+    /**
+    * @brief        배열의 모든 데이터를 1000으로 나누는 함수
+    * @param[in]    pSrc            1000으로 나눌 데이터 배열
+    * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+    * @param[in]    nCount          배열의 길이
+    */
+    inline void Div1000(const int32_t* pSrc, int32_t* pDst, size_t nCount) noexcept
+    {
+        DivConst<1000>::Div(pSrc, pDst, nCount);
+    }
+    /**
+    * @brief        실행 중에 정해지는 제수의 역수를 미리 계산해두고 나눗셈을 곱셈으로 대체하는 클래스
+    * @details      설정값 등 한 번 정해진 후 바뀌지 않는 제수로 많은 데이터를 나눌 때 사용
+    *               모든 입력에 대해 '/' 연산과 동일한 결과 (0 방향 버림)
+    * @tparam       T               int32_t, uint32_t, int64_t, uint64_t
+    */
+    template <typename T>
+    class FastDivider
+    {
+        static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t> ||
+            std::is_same_v<T, int64_t> || std::is_same_v<T, uint64_t>,
+            "int32_t, uint32_t, int64_t, uint64_t 만 가능");
+
+    public:
+        /**
+        * @brief        생성자
+        * @param[in]    nDivisor        제수 (0인 경우 std::invalid_argument 예외 발생)
+        */
+        explicit FastDivider(T nDivisor)
+            : m_nDivisor(nDivisor)
+        {
+            if (nDivisor == 0)
+            {
+                throw std::invalid_argument("divisor is zero.");
+            }
+
+            if constexpr (std::is_same_v<T, int32_t>)
+            {
+                m_magic32 = detail::MakeDivMagic32(nDivisor);
+            }
+            else if constexpr (std::is_same_v<T, int64_t>)
+            {
+                m_magic64 = detail::MakeDivMagic64(nDivisor);
+            }
+            else
+            {
+                m_magicU = detail::MakeDivMagicU(nDivisor);
+            }
+        }
+
+        /**
+        * @brief        제수를 반환하는 함수
+        * @return       제수
+        */
+        T GetDivisor() const noexcept
+        {
+            return m_nDivisor;
+        }
+        /**
+        * @brief        제수로 나누는 함수
+        * @param[in]    nDiv            나눌 데이터
+        * @return       나눈 결과값 (정수)
+        */
+        T Div(T nDiv) const noexcept
+        {
+            if constexpr (std::is_same_v<T, int32_t>)
+            {
+                return detail::DivByMagic(nDiv, m_magic32);
+            }
+            else if constexpr (std::is_same_v<T, int64_t>)
+            {
+                return detail::DivByMagic(nDiv, m_magic64);
+            }
+            else
+            {
+                return detail::DivByMagicU(nDiv, m_magicU);
+            }
+        }
+        /**
+        * @brief        배열의 모든 데이터를 제수로 나누는 함수 (32비트는 AVX2/NEON 사용 가능 시 벡터 연산)
+        * @param[in]    pSrc            나눌 데이터 배열
+        * @param[out]   pDst            결과 배열 (pSrc와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        */
+        void Div(const T* pSrc, T* pDst, size_t nCount) const noexcept
+        {
+            if constexpr (std::is_same_v<T, int32_t>)
+            {
+                detail::DivBatchByMagic(pSrc, pDst, nCount, m_magic32);
+            }
+            else if constexpr (std::is_same_v<T, uint32_t>)
+            {
+                detail::DivBatchByMagicU(pSrc, pDst, nCount, m_magicU);
+            }
+            else
+            {
+                for (size_t i = 0; i < nCount; ++i)
+                {
+                    pDst[i] = Div(pSrc[i]);
+                }
+            }
+        }
+
+        friend T operator/(T nDiv, const FastDivider& divider) noexcept
+        {
+            return divider.Div(nDiv);
+        }
+
+    private:
+        T m_nDivisor;
+        detail::DivMagic32 m_magic32{};
+        detail::DivMagic64 m_magic64{};
+        detail::DivMagicU m_magicU{};
+    };
+    /**
     * @brief        현재 데이터가 타겟 데이터에 오차범위(값) 내에 들어왔는지 확인하는 함수
     * @param[in]    dData           현재 데이터
     * @param[in]    dTarget         타겟 데이터
@@ -82,11 +611,234 @@ namespace esk::gearforge::util::calc
 
         return dData >= dNRange && dData <= dPRange;
     }
+
+    namespace detail
+    {
+        /**
+        * @brief        최대 64개 데이터의 오차범위 이탈 여부를 비트마스크로 반환하는 함수 (AVX-512/AVX2 사용 가능 시 벡터 연산)
+        * @tparam       IS_PERCENT      true: 오차범위(퍼센트), false: 오차범위(값)
+        * @tparam       IS_ARRAY        true: 타겟 배열 사용, false: 단일 타겟 사용
+        * @param[in]    pData           현재 데이터 배열
+        * @param[in]    pTarget         타겟 데이터 배열 (IS_ARRAY == false 인 경우 미사용)
+        * @param[in]    dTarget         타겟 데이터 (IS_ARRAY == true 인 경우 미사용)
+        * @param[in]    nCount          배열의 길이 (최대 64)
+        * @param[in]    dOffset         오차 범위
+        * @return       벗어난 데이터의 위치에 1이 설정된 비트마스크
+        */
+        template <bool IS_PERCENT, bool IS_ARRAY>
+        inline uint64_t CheckOffsetBlock(const double* pData, const double* pTarget, double dTarget, size_t nCount, double dOffset) noexcept
+        {
+            uint64_t nOutMask = 0;
+            size_t i = 0;
+#if defined(ESK_SIMD_AVX512) || defined(ESK_SIMD_AVX2)
+            // 스칼라 함수와 같은 순서로 계산해야 경계값 결과가 동일함
+            double dScale = IS_PERCENT ?
+                (dOffset >= 0 ? dOffset * 0.01 : dOffset * -0.01) :
+                (dOffset > 0.0 ? dOffset : -dOffset);
+#endif
+#if defined(ESK_SIMD_AVX512)
+            const __m512d vScale = _mm512_set1_pd(dScale);
+            __m512d vTarget = _mm512_set1_pd(dTarget);
+            for (; i + 8 <= nCount; i += 8)
+            {
+                if constexpr (IS_ARRAY)
+                {
+                    vTarget = _mm512_loadu_pd(pTarget + i);
+                }
+                __m512d vDiff = IS_PERCENT ? _mm512_mul_pd(vTarget, vScale) : vScale;
+                __m512d vData = _mm512_loadu_pd(pData + i);
+                __mmask8 nIn = _mm512_cmp_pd_mask(vData, _mm512_sub_pd(vTarget, vDiff), _CMP_GE_OQ) &
+                    _mm512_cmp_pd_mask(vData, _mm512_add_pd(vTarget, vDiff), _CMP_LE_OQ);
+                nOutMask |= static_cast<uint64_t>(static_cast<uint8_t>(~nIn)) << i;
+            }
+#elif defined(ESK_SIMD_AVX2)
+            const __m256d vScale = _mm256_set1_pd(dScale);
+            __m256d vTarget = _mm256_set1_pd(dTarget);
+            for (; i + 4 <= nCount; i += 4)
+            {
+                if constexpr (IS_ARRAY)
+                {
+                    vTarget = _mm256_loadu_pd(pTarget + i);
+                }
+                __m256d vDiff = IS_PERCENT ? _mm256_mul_pd(vTarget, vScale) : vScale;
+                __m256d vData = _mm256_loadu_pd(pData + i);
+                __m256d vIn = _mm256_and_pd(
+                    _mm256_cmp_pd(vData, _mm256_sub_pd(vTarget, vDiff), _CMP_GE_OQ),
+                    _mm256_cmp_pd(vData, _mm256_add_pd(vTarget, vDiff), _CMP_LE_OQ));
+                nOutMask |= static_cast<uint64_t>(~_mm256_movemask_pd(vIn) & 0xF) << i;
+            }
+#endif
+            for (; i < nCount; ++i)
+            {
+                double dCurTarget = IS_ARRAY ? pTarget[i] : dTarget;
+                bool bIsIn = IS_PERCENT ?
+                    IsOffsetInPercent(pData[i], dCurTarget, dOffset) :
+                    IsOffsetInValue(pData[i], dCurTarget, dOffset);
+                nOutMask |= static_cast<uint64_t>(!bIsIn) << i;
+            }
+            return nOutMask;
+        }
+        /**
+        * @brief        배열 전체의 오차범위 이탈 여부를 검사하는 함수
+        * @param[out]   pOutMask        이탈 비트마스크 (nullptr 가능, (nCount + 63) / 64 개 필요)
+        * @param[in]    bIsStopFirst    true: 처음 이탈한 블록(64개 단위)에서 검사 중단
+        * @return       이탈한 데이터의 개수 (bIsStopFirst == true 이면 0 또는 첫 블록의 이탈 개수)
+        */
+        template <bool IS_PERCENT, bool IS_ARRAY>
+        inline size_t CheckOffsetBatch(const double* pData, const double* pTarget, double dTarget, size_t nCount, double dOffset,
+            uint64_t* pOutMask, bool bIsStopFirst) noexcept
+        {
+            if (pData == nullptr ||
+                (IS_ARRAY && pTarget == nullptr))
+            {
+                return 0;
+            }
+
+            size_t nOutCount = 0;
+            for (size_t nBase = 0; nBase < nCount; nBase += 64)
+            {
+                size_t nBlock = nCount - nBase < 64 ? nCount - nBase : 64;
+                uint64_t nMask = CheckOffsetBlock<IS_PERCENT, IS_ARRAY>(
+                    pData + nBase, IS_ARRAY ? pTarget + nBase : nullptr, dTarget, nBlock, dOffset);
+                if (pOutMask != nullptr)
+                {
+                    pOutMask[nBase / 64] = nMask;
+                }
+                nOutCount += static_cast<size_t>(std::popcount(nMask));
+                if (bIsStopFirst &&
+                    nMask != 0)
+                {
+                    break;
+                }
+            }
+            return nOutCount;
+        }
+    } // namespace detail
+
+    /**
+    * @brief        데이터 배열이 타겟 배열에 오차범위(값) 내에 들어왔는지 일괄 확인하는 함수
+    * @param[in]    pData           현재 데이터 배열
+    * @param[in]    pTarget         타겟 데이터 배열
+    * @param[in]    nCount          배열의 길이
+    * @param[in]    dOffset         오차 범위 (값, 음수인 경우 양수로 치환함)
+    * @param[out]   pOutMask        벗어난 데이터의 위치에 1이 설정된 비트마스크 (nullptr 가능, (nCount + 63) / 64 개 필요)
+    * @return       벗어난 데이터의 개수
+    */
+    inline size_t CheckOffsetInValue(const double* pData, const double* pTarget, size_t nCount, double dOffset, uint64_t* pOutMask = nullptr) noexcept
+    {
+        return detail::CheckOffsetBatch<false, true>(pData, pTarget, 0.0, nCount, dOffset, pOutMask, false);
+    }
+    /**
+    * @brief        데이터 배열이 단일 타겟에 오차범위(값) 내에 들어왔는지 일괄 확인하는 함수
+    * @param[in]    pData           현재 데이터 배열
+    * @param[in]    dTarget         타겟 데이터
+    * @param[in]    nCount          배열의 길이
+    * @param[in]    dOffset         오차 범위 (값, 음수인 경우 양수로 치환함)
+    * @param[out]   pOutMask        벗어난 데이터의 위치에 1이 설정된 비트마스크 (nullptr 가능, (nCount + 63) / 64 개 필요)
+    * @return       벗어난 데이터의 개수
+    */
+    inline size_t CheckOffsetInValue(const double* pData, double dTarget, size_t nCount, double dOffset, uint64_t* pOutMask = nullptr) noexcept
+    {
+        return detail::CheckOffsetBatch<false, false>(pData, nullptr, dTarget, nCount, dOffset, pOutMask, false);
+    }
+    /**
+    * @brief        데이터 배열이 타겟 배열에 오차범위(퍼센트) 내에 들어왔는지 일괄 확인하는 함수
+    * @param[in]    pData           현재 데이터 배열
+    * @param[in]    pTarget         타겟 데이터 배열
+    * @param[in]    nCount          배열의 길이
+    * @param[in]    dOffsetPer      오차 범위 (퍼센트: 10% -> 10입력, 음수인 경우 양수로 치환함)
+    * @param[out]   pOutMask        벗어난 데이터의 위치에 1이 설정된 비트마스크 (nullptr 가능, (nCount + 63) / 64 개 필요)
+    * @return       벗어난 데이터의 개수
+    */
+    inline size_t CheckOffsetInPercent(const double* pData, const double* pTarget, size_t nCount, double dOffsetPer, uint64_t* pOutMask = nullptr) noexcept
+    {
+        return detail::CheckOffsetBatch<true, true>(pData, pTarget, 0.0, nCount, dOffsetPer, pOutMask, false);
+    }
+    /**
+    * @brief        데이터 배열이 단일 타겟에 오차범위(퍼센트) 내에 들어왔는지 일괄 확인하는 함수
+    * @param[in]    pData           현재 데이터 배열
+    * @param[in]    dTarget         타겟 데이터
+    * @param[in]    nCount          배열의 길이
+    * @param[in]    dOffsetPer      오차 범위 (퍼센트: 10% -> 10입력, 음수인 경우 양수로 치환함)
+    * @param[out]   pOutMask        벗어난 데이터의 위치에 1이 설정된 비트마스크 (nullptr 가능, (nCount + 63) / 64 개 필요)
+    * @return       벗어난 데이터의 개수
+    */
+    inline size_t CheckOffsetInPercent(const double* pData, double dTarget, size_t nCount, double dOffsetPer, uint64_t* pOutMask = nullptr) noexcept
+    {
+        return detail::CheckOffsetBatch<true, false>(pData, nullptr, dTarget, nCount, dOffsetPer, pOutMask, false);
+    }
+    /**
+    * @brief        데이터 배열이 모두 타겟 배열에 오차범위(값) 내에 들어왔는지 확인하는 함수 (이탈 발견 시 즉시 종료)
+    * @return       true: 모두 들어옴, false: 하나 이상 벗어남
+    */
+    inline bool IsAllOffsetInValue(const double* pData, const double* pTarget, size_t nCount, double dOffset) noexcept
+    {
+        return detail::CheckOffsetBatch<false, true>(pData, pTarget, 0.0, nCount, dOffset, nullptr, true) == 0;
+    }
+    /**
+    * @brief        데이터 배열이 모두 단일 타겟에 오차범위(값) 내에 들어왔는지 확인하는 함수 (이탈 발견 시 즉시 종료)
+    * @return       true: 모두 들어옴, false: 하나 이상 벗어남
+    */
+    inline bool IsAllOffsetInValue(const double* pData, double dTarget, size_t nCount, double dOffset) noexcept
+    {
+        return detail::CheckOffsetBatch<false, false>(pData, nullptr, dTarget, nCount, dOffset, nullptr, true) == 0;
+    }
+    /**
+    * @brief        데이터 배열이 모두 타겟 배열에 오차범위(퍼센트) 내에 들어왔는지 확인하는 함수 (이탈 발견 시 즉시 종료)
+    * @return       true: 모두 들어옴, false: 하나 이상 벗어남
+    */
+    inline bool IsAllOffsetInPercent(const double* pData, const double* pTarget, size_t nCount, double dOffsetPer) noexcept
+    {
+        return detail::CheckOffsetBatch<true, true>(pData, pTarget, 0.0, nCount, dOffsetPer, nullptr, true) == 0;
+    }
+    /**
+    * @brief        데이터 배열이 모두 단일 타겟에 오차범위(퍼센트) 내에 들어왔는지 확인하는 함수 (이탈 발견 시 즉시 종료)
+    * @return       true: 모두 들어옴, false: 하나 이상 벗어남
+    */
+    inline bool IsAllOffsetInPercent(const double* pData, double dTarget, size_t nCount, double dOffsetPer) noexcept
+    {
+        return detail::CheckOffsetBatch<true, false>(pData, nullptr, dTarget, nCount, dOffsetPer, nullptr, true) == 0;
+    }
+    /**
+    * @brief        비트마스크에서 1로 설정된 위치(인덱스) 목록을 반환하는 함수
+    * @param[in]    pMask           비트마스크 ((nCount + 63) / 64 개)
+    * @param[in]    nCount          비트마스크가 나타내는 데이터의 개수
+    * @param[out]   pOutIndex       인덱스 목록
+    * @param[in]    nMaxIndex       pOutIndex의 최대 길이
+    * @return       pOutIndex에 기록한 인덱스의 개수
+    */
+    inline size_t GetMaskIndices(const uint64_t* pMask, size_t nCount, size_t* pOutIndex, size_t nMaxIndex) noexcept
+    {
+        if (pMask == nullptr ||
+            pOutIndex == nullptr)
+        {
+            return 0;
+        }
+
+        size_t nOutCount = 0;
+        for (size_t nWord = 0; nWord * 64 < nCount && nOutCount < nMaxIndex; ++nWord)
+        {
+            uint64_t nMask = pMask[nWord];
+            while (nMask != 0 &&
+                nOutCount < nMaxIndex)
+            {
+                size_t nIndex = nWord * 64 + static_cast<size_t>(std::countr_zero(nMask));
+                if (nIndex >= nCount)
+                {
+                    break;
+                }
+                pOutIndex[nOutCount++] = nIndex;
+                nMask &= nMask - 1;
+            }
+        }
+        return nOutCount;
+    }
     /**
     * @brief        실수의 Equal 연산을 수행하는 함수
     * @param[in]    dNum1           실수1
     * @param[in]    dNum2           실수2
     * @return       true: 오차범위 내에서 같음, false: 오차범위 내에서 다름
+    * @details      epsilon을 절대 오차로 사용하므로 1보다 큰 값의 비교에는 IsClose 또는 UlpEquals 사용
     */
     inline bool EpsEquals(double dNum1, double dNum2)
     {
@@ -97,9 +849,1467 @@ namespace esk::gearforge::util::calc
     * @param[in]    fNum1           실수1
     * @param[in]    fNum2           실수2
     * @return       true: 오차범위 내에서 같음, false: 오차범위 내에서 다름
+    * @details      epsilon을 절대 오차로 사용하므로 1보다 큰 값의 비교에는 IsClose 또는 UlpEquals 사용
     */
     inline bool EpsEquals(float fNum1, float fNum2)
     {
         return std::abs(fNum1 - fNum2) < std::numeric_limits<float>::epsilon();
     }
+    /**
+    * @brief        두 실수 사이에 존재하는 표현 가능한 실수의 개수(ULP 거리)를 반환하는 함수
+    * @param[in]    dNum1           실수1
+    * @param[in]    dNum2           실수2
+    * @return       ULP 거리 (+0.0과 -0.0은 0, 어느 한쪽이 NaN이면 UINT64_MAX)
+    */
+    inline uint64_t UlpDistance(double dNum1, double dNum2) noexcept
+    {
+        if (std::isnan(dNum1) ||
+            std::isnan(dNum2))
+        {
+            return (std::numeric_limits<uint64_t>::max)();
+        }
+
+        // 부호-크기 표현을 2의 보수 순서로 변환
+        int64_t nBits1 = std::bit_cast<int64_t>(dNum1);
+        int64_t nBits2 = std::bit_cast<int64_t>(dNum2);
+        nBits1 = nBits1 < 0 ? (std::numeric_limits<int64_t>::min)() - nBits1 : nBits1;
+        nBits2 = nBits2 < 0 ? (std::numeric_limits<int64_t>::min)() - nBits2 : nBits2;
+        return nBits1 > nBits2 ?
+            static_cast<uint64_t>(nBits1) - static_cast<uint64_t>(nBits2) :
+            static_cast<uint64_t>(nBits2) - static_cast<uint64_t>(nBits1);
+    }
+    /**
+    * @brief        두 실수 사이에 존재하는 표현 가능한 실수의 개수(ULP 거리)를 반환하는 함수
+    * @param[in]    fNum1           실수1
+    * @param[in]    fNum2           실수2
+    * @return       ULP 거리 (+0.0과 -0.0은 0, 어느 한쪽이 NaN이면 UINT32_MAX)
+    */
+    inline uint32_t UlpDistance(float fNum1, float fNum2) noexcept
+    {
+        if (std::isnan(fNum1) ||
+            std::isnan(fNum2))
+        {
+            return (std::numeric_limits<uint32_t>::max)();
+        }
+
+        int32_t nBits1 = std::bit_cast<int32_t>(fNum1);
+        int32_t nBits2 = std::bit_cast<int32_t>(fNum2);
+        nBits1 = nBits1 < 0 ? (std::numeric_limits<int32_t>::min)() - nBits1 : nBits1;
+        nBits2 = nBits2 < 0 ? (std::numeric_limits<int32_t>::min)() - nBits2 : nBits2;
+        return nBits1 > nBits2 ?
+            static_cast<uint32_t>(nBits1) - static_cast<uint32_t>(nBits2) :
+            static_cast<uint32_t>(nBits2) - static_cast<uint32_t>(nBits1);
+    }
+    /**
+    * @brief        ULP 거리 기준으로 실수의 Equal 연산을 수행하는 함수 (값의 크기와 무관하게 상대 정밀도로 비교)
+    * @param[in]    dNum1           실수1
+    * @param[in]    dNum2           실수2
+    * @param[in]    nMaxUlp         허용 ULP 거리
+    * @return       true: 허용 ULP 거리 내에서 같음, false: 다름 (NaN 포함)
+    */
+    inline bool UlpEquals(double dNum1, double dNum2, uint64_t nMaxUlp = 4) noexcept
+    {
+        return !std::isnan(dNum1) && !std::isnan(dNum2) && UlpDistance(dNum1, dNum2) <= nMaxUlp;
+    }
+    /**
+    * @brief        ULP 거리 기준으로 실수의 Equal 연산을 수행하는 함수 (값의 크기와 무관하게 상대 정밀도로 비교)
+    * @param[in]    fNum1           실수1
+    * @param[in]    fNum2           실수2
+    * @param[in]    nMaxUlp         허용 ULP 거리
+    * @return       true: 허용 ULP 거리 내에서 같음, false: 다름 (NaN 포함)
+    */
+    inline bool UlpEquals(float fNum1, float fNum2, uint32_t nMaxUlp = 4) noexcept
+    {
+        return !std::isnan(fNum1) && !std::isnan(fNum2) && UlpDistance(fNum1, fNum2) <= nMaxUlp;
+    }
+
+    namespace detail
+    {
+        template <typename T>
+        inline bool IsCloseImpl(T num1, T num2, T relTol, T absTol) noexcept
+        {
+            // 같은 부호의 무한대끼리는 같음
+            if (num1 == num2)
+            {
+                return true;
+            }
+
+            T diff = std::abs(num1 - num2);
+            T absNum1 = std::abs(num1);
+            T absNum2 = std::abs(num2);
+            T tol = relTol * (absNum1 > absNum2 ? absNum1 : absNum2);
+            tol = tol > absTol ? tol : absTol;
+            return diff < std::numeric_limits<T>::infinity() && diff <= tol;
+        }
+    } // namespace detail
+
+    /**
+    * @brief        상대/절대 오차 기준으로 실수의 Equal 연산을 수행하는 함수
+    * @details      |dNum1 - dNum2| <= max(dRelTol * max(|dNum1|, |dNum2|), dAbsTol)
+    * @param[in]    dNum1           실수1
+    * @param[in]    dNum2           실수2
+    * @param[in]    dRelTol         상대 오차 (큰 값의 비교에 사용)
+    * @param[in]    dAbsTol         절대 오차 (0 근처 값의 비교에 사용)
+    * @return       true: 오차범위 내에서 같음, false: 오차범위 내에서 다름 (NaN 포함)
+    */
+    inline bool IsClose(double dNum1, double dNum2, double dRelTol = 1e-9, double dAbsTol = 0.0) noexcept
+    {
+        return detail::IsCloseImpl(dNum1, dNum2, dRelTol, dAbsTol);
+    }
+    /**
+    * @brief        상대/절대 오차 기준으로 실수의 Equal 연산을 수행하는 함수
+    * @details      |fNum1 - fNum2| <= max(fRelTol * max(|fNum1|, |fNum2|), fAbsTol)
+    * @param[in]    fNum1           실수1
+    * @param[in]    fNum2           실수2
+    * @param[in]    fRelTol         상대 오차 (큰 값의 비교에 사용)
+    * @param[in]    fAbsTol         절대 오차 (0 근처 값의 비교에 사용)
+    * @return       true: 오차범위 내에서 같음, false: 오차범위 내에서 다름 (NaN 포함)
+    */
+    inline bool IsClose(float fNum1, float fNum2, float fRelTol = 1e-5f, float fAbsTol = 0.0f) noexcept
+    {
+        return detail::IsCloseImpl(fNum1, fNum2, fRelTol, fAbsTol);
+    }
+
+    /**
+    * @brief        AllClose 함수의 불일치 결과 정보
+    */
+    struct CloseReport
+    {
+        size_t nMismatchCount = 0;                                      // 불일치 개수
+        size_t nFirstMismatch = (std::numeric_limits<size_t>::max)();     // 첫 불일치 위치 (불일치가 없으면 SIZE_MAX)
+        size_t nMaxDiffIndex = (std::numeric_limits<size_t>::max)();      // 차이가 가장 큰 불일치 위치
+        double dMaxAbsDiff = 0.0;                                       // 불일치 중 가장 큰 차이 (NaN 제외)
+    };
+
+    namespace detail
+    {
+        /**
+        * @brief        불일치 위치 하나를 결과 정보에 반영하는 함수
+        */
+        template <typename T>
+        inline void AddCloseMismatch(CloseReport* pReport, size_t nIndex, T num1, T num2) noexcept
+        {
+            if (pReport->nMismatchCount++ == 0)
+            {
+                pReport->nFirstMismatch = nIndex;
+            }
+
+            double dDiff = std::abs(static_cast<double>(num1) - static_cast<double>(num2));
+            if (dDiff > pReport->dMaxAbsDiff ||
+                pReport->nMaxDiffIndex == (std::numeric_limits<size_t>::max)())
+            {
+                if (!std::isnan(dDiff))
+                {
+                    pReport->dMaxAbsDiff = dDiff;
+                    pReport->nMaxDiffIndex = nIndex;
+                }
+            }
+        }
+        /**
+        * @brief        두 배열이 오차범위 내에서 같은지 확인하는 함수 (AVX2 사용 가능 시 벡터 연산)
+        * @details      불일치가 없는 구간은 벡터 연산만 수행하고, 불일치가 있는 구간만 스칼라로 결과 정보를 기록함
+        */
+        template <typename T>
+        inline bool AllCloseImpl(const T* pArr1, const T* pArr2, size_t nCount, T relTol, T absTol, CloseReport* pReport) noexcept
+        {
+            if (pReport != nullptr)
+            {
+                *pReport = CloseReport();
+            }
+            if (pArr1 == nullptr ||
+                pArr2 == nullptr)
+            {
+                return nCount == 0;
+            }
+
+            size_t i = 0;
+            bool bIsAllClose = true;
+#if defined(ESK_SIMD_AVX2)
+            if constexpr (std::is_same_v<T, double>)
+            {
+                const __m256d vSignMask = _mm256_set1_pd(-0.0);
+                const __m256d vRelTol = _mm256_set1_pd(relTol);
+                const __m256d vAbsTol = _mm256_set1_pd(absTol);
+                const __m256d vInf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+                for (; i + 4 <= nCount; i += 4)
+                {
+                    __m256d v1 = _mm256_loadu_pd(pArr1 + i);
+                    __m256d v2 = _mm256_loadu_pd(pArr2 + i);
+                    __m256d vDiff = _mm256_andnot_pd(vSignMask, _mm256_sub_pd(v1, v2));
+                    __m256d vTol = _mm256_mul_pd(vRelTol, _mm256_max_pd(_mm256_andnot_pd(vSignMask, v1), _mm256_andnot_pd(vSignMask, v2)));
+                    vTol = _mm256_max_pd(vTol, vAbsTol);
+                    __m256d vOk = _mm256_or_pd(_mm256_cmp_pd(v1, v2, _CMP_EQ_OQ),
+                        _mm256_and_pd(_mm256_cmp_pd(vDiff, vTol, _CMP_LE_OQ), _mm256_cmp_pd(vDiff, vInf, _CMP_LT_OQ)));
+                    int nBad = ~_mm256_movemask_pd(vOk) & 0xF;
+                    if (nBad != 0)
+                    {
+                        bIsAllClose = false;
+                        if (pReport == nullptr)
+                        {
+                            return false;
+                        }
+                        for (; nBad != 0; nBad &= nBad - 1)
+                        {
+                            size_t nIndex = i + static_cast<size_t>(std::countr_zero(static_cast<unsigned int>(nBad)));
+                            AddCloseMismatch(pReport, nIndex, pArr1[nIndex], pArr2[nIndex]);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                const __m256 vSignMask = _mm256_set1_ps(-0.0f);
+                const __m256 vRelTol = _mm256_set1_ps(relTol);
+                const __m256 vAbsTol = _mm256_set1_ps(absTol);
+                const __m256 vInf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+                for (; i + 8 <= nCount; i += 8)
+                {
+                    __m256 v1 = _mm256_loadu_ps(pArr1 + i);
+                    __m256 v2 = _mm256_loadu_ps(pArr2 + i);
+                    __m256 vDiff = _mm256_andnot_ps(vSignMask, _mm256_sub_ps(v1, v2));
+                    __m256 vTol = _mm256_mul_ps(vRelTol, _mm256_max_ps(_mm256_andnot_ps(vSignMask, v1), _mm256_andnot_ps(vSignMask, v2)));
+                    vTol = _mm256_max_ps(vTol, vAbsTol);
+                    __m256 vOk = _mm256_or_ps(_mm256_cmp_ps(v1, v2, _CMP_EQ_OQ),
+                        _mm256_and_ps(_mm256_cmp_ps(vDiff, vTol, _CMP_LE_OQ), _mm256_cmp_ps(vDiff, vInf, _CMP_LT_OQ)));
+                    int nBad = ~_mm256_movemask_ps(vOk) & 0xFF;
+                    if (nBad != 0)
+                    {
+                        bIsAllClose = false;
+                        if (pReport == nullptr)
+                        {
+                            return false;
+                        }
+                        for (; nBad != 0; nBad &= nBad - 1)
+                        {
+                            size_t nIndex = i + static_cast<size_t>(std::countr_zero(static_cast<unsigned int>(nBad)));
+                            AddCloseMismatch(pReport, nIndex, pArr1[nIndex], pArr2[nIndex]);
+                        }
+                    }
+                }
+            }
+#endif
+            for (; i < nCount; ++i)
+            {
+                if (!IsCloseImpl(pArr1[i], pArr2[i], relTol, absTol))
+                {
+                    bIsAllClose = false;
+                    if (pReport == nullptr)
+                    {
+                        return false;
+                    }
+                    AddCloseMismatch(pReport, i, pArr1[i], pArr2[i]);
+                }
+            }
+            return bIsAllClose;
+        }
+    } // namespace detail
+
+    /**
+    * @brief        두 배열의 모든 원소가 상대/절대 오차 기준으로 같은지 확인하는 함수 (결과 파일 검증용)
+    * @param[in]    pArr1           배열1
+    * @param[in]    pArr2           배열2
+    * @param[in]    nCount          배열의 길이
+    * @param[in]    dRelTol         상대 오차
+    * @param[in]    dAbsTol         절대 오차
+    * @param[out]   pReport         불일치 결과 정보 (nullptr 인 경우 첫 불일치에서 즉시 종료)
+    * @return       true: 모두 같음, false: 하나 이상 다름
+    */
+    inline bool AllClose(const double* pArr1, const double* pArr2, size_t nCount,
+        double dRelTol = 1e-9, double dAbsTol = 0.0, CloseReport* pReport = nullptr) noexcept
+    {
+        return detail::AllCloseImpl(pArr1, pArr2, nCount, dRelTol, dAbsTol, pReport);
+    }
+    /**
+    * @brief        두 배열의 모든 원소가 상대/절대 오차 기준으로 같은지 확인하는 함수 (결과 파일 검증용)
+    * @param[in]    pArr1           배열1
+    * @param[in]    pArr2           배열2
+    * @param[in]    nCount          배열의 길이
+    * @param[in]    fRelTol         상대 오차
+    * @param[in]    fAbsTol         절대 오차
+    * @param[out]   pReport         불일치 결과 정보 (nullptr 인 경우 첫 불일치에서 즉시 종료)
+    * @return       true: 모두 같음, false: 하나 이상 다름
+    */
+    inline bool AllClose(const float* pArr1, const float* pArr2, size_t nCount,
+        float fRelTol = 1e-5f, float fAbsTol = 0.0f, CloseReport* pReport = nullptr) noexcept
+    {
+        return detail::AllCloseImpl(pArr1, pArr2, nCount, fRelTol, fAbsTol, pReport);
+    }
+
+    namespace detail
+    {
+        /**
+        * @brief        배열의 합계, 최소값, 최대값을 구하는 함수 (AVX2 사용 가능 시 벡터 연산)
+        * @param[in]    pData           데이터 배열
+        * @param[in]    nCount          배열의 길이
+        * @param[out]   pSum            합계
+        * @param[out]   pMin            최소값
+        * @param[out]   pMax            최대값
+        */
+        inline void SumMinMax(const double* pData, size_t nCount, double* pSum, double* pMin, double* pMax) noexcept
+        {
+            size_t i = 0;
+            double dSum = 0.0;
+            double dMin = std::numeric_limits<double>::infinity();
+            double dMax = -std::numeric_limits<double>::infinity();
+#if defined(ESK_SIMD_AVX2)
+            if (nCount >= 4)
+            {
+                __m256d vSum = _mm256_setzero_pd();
+                __m256d vMin = _mm256_set1_pd(dMin);
+                __m256d vMax = _mm256_set1_pd(dMax);
+                for (; i + 4 <= nCount; i += 4)
+                {
+                    __m256d vData = _mm256_loadu_pd(pData + i);
+                    vSum = _mm256_add_pd(vSum, vData);
+                    vMin = _mm256_min_pd(vMin, vData);
+                    vMax = _mm256_max_pd(vMax, vData);
+                }
+
+                alignas(32) double arrSum[4];
+                alignas(32) double arrMin[4];
+                alignas(32) double arrMax[4];
+                _mm256_store_pd(arrSum, vSum);
+                _mm256_store_pd(arrMin, vMin);
+                _mm256_store_pd(arrMax, vMax);
+                for (int j = 0; j < 4; ++j)
+                {
+                    dSum += arrSum[j];
+                    dMin = arrMin[j] < dMin ? arrMin[j] : dMin;
+                    dMax = arrMax[j] > dMax ? arrMax[j] : dMax;
+                }
+            }
+#endif
+            for (; i < nCount; ++i)
+            {
+                dSum += pData[i];
+                dMin = pData[i] < dMin ? pData[i] : dMin;
+                dMax = pData[i] > dMax ? pData[i] : dMax;
+            }
+            *pSum = dSum;
+            *pMin = dMin;
+            *pMax = dMax;
+        }
+        /**
+        * @brief        배열의 편차 제곱합을 구하는 함수 (AVX2 사용 가능 시 벡터 연산)
+        * @param[in]    pData           데이터 배열
+        * @param[in]    nCount          배열의 길이
+        * @param[in]    dMean           배열의 평균
+        * @return       sum((x - dMean)^2)
+        */
+        inline double SumSquaredDiff(const double* pData, size_t nCount, double dMean) noexcept
+        {
+            size_t i = 0;
+            double dSum = 0.0;
+#if defined(ESK_SIMD_AVX2)
+            if (nCount >= 4)
+            {
+                const __m256d vMean = _mm256_set1_pd(dMean);
+                __m256d vSum = _mm256_setzero_pd();
+                for (; i + 4 <= nCount; i += 4)
+                {
+                    __m256d vDiff = _mm256_sub_pd(_mm256_loadu_pd(pData + i), vMean);
+                    vSum = _mm256_add_pd(vSum, _mm256_mul_pd(vDiff, vDiff));
+                }
+
+                alignas(32) double arrSum[4];
+                _mm256_store_pd(arrSum, vSum);
+                dSum = (arrSum[0] + arrSum[1]) + (arrSum[2] + arrSum[3]);
+            }
+#endif
+            for (; i < nCount; ++i)
+            {
+                double dDiff = pData[i] - dMean;
+                dSum += dDiff * dDiff;
+            }
+            return dSum;
+        }
+    } // namespace detail
+
+    /**
+    * @brief        데이터를 저장하지 않고 개수, 평균, 분산, 최소값, 최대값을 누적 계산하는 클래스 (Welford)
+    * @details      스레드별로 누적한 뒤 Merge 함수로 합칠 수 있음 (메모리 사용량 O(1))
+    */
+    class RunningStats
+    {
+    public:
+        /**
+        * @brief        데이터를 하나 추가하는 함수
+        * @param[in]    dValue          추가할 데이터
+        */
+        void Add(double dValue) noexcept
+        {
+            ++m_nCount;
+            double dDelta = dValue - m_dMean;
+            m_dMean += dDelta / static_cast<double>(m_nCount);
+            m_dM2 += dDelta * (dValue - m_dMean);
+            m_dMin = dValue < m_dMin ? dValue : m_dMin;
+            m_dMax = dValue > m_dMax ? dValue : m_dMax;
+        }
+        /**
+        * @brief        데이터 배열을 한 번에 추가하는 함수 (배열 단위로 계산 후 병합하므로 벡터 연산 가능)
+        * @param[in]    pData           추가할 데이터 배열
+        * @param[in]    nCount          배열의 길이
+        */
+        void Add(const double* pData, size_t nCount) noexcept
+        {
+            if (pData == nullptr ||
+                nCount == 0)
+            {
+                return;
+            }
+
+            double dSum = 0.0;
+            double dMin = 0.0;
+            double dMax = 0.0;
+            detail::SumMinMax(pData, nCount, &dSum, &dMin, &dMax);
+            double dMean = dSum / static_cast<double>(nCount);
+            double dM2 = detail::SumSquaredDiff(pData, nCount, dMean);
+            Merge(nCount, dMean, dM2, dMin, dMax);
+        }
+        /**
+        * @brief        다른 누적 결과를 합치는 함수 (Chan 병렬 알고리즘)
+        * @param[in]    other           합칠 누적 결과
+        */
+        void Merge(const RunningStats& other) noexcept
+        {
+            Merge(other.m_nCount, other.m_dMean, other.m_dM2, other.m_dMin, other.m_dMax);
+        }
+        /**
+        * @brief        누적 결과를 초기화하는 함수
+        */
+        void Reset() noexcept
+        {
+            *this = RunningStats();
+        }
+
+        uint64_t GetCount() const noexcept
+        {
+            return m_nCount;
+        }
+        double GetMean() const noexcept
+        {
+            return m_dMean;
+        }
+        /**
+        * @brief        모분산을 반환하는 함수
+        * @return       모분산 (데이터가 없으면 0)
+        */
+        double GetVariance() const noexcept
+        {
+            return m_nCount > 0 ? m_dM2 / static_cast<double>(m_nCount) : 0.0;
+        }
+        /**
+        * @brief        표본분산을 반환하는 함수
+        * @return       표본분산 (데이터가 2개 미만이면 0)
+        */
+        double GetSampleVariance() const noexcept
+        {
+            return m_nCount > 1 ? m_dM2 / static_cast<double>(m_nCount - 1) : 0.0;
+        }
+        double GetStdDev() const noexcept
+        {
+            return std::sqrt(GetVariance());
+        }
+        /**
+        * @brief        최소값을 반환하는 함수
+        * @return       최소값 (데이터가 없으면 +inf)
+        */
+        double GetMin() const noexcept
+        {
+            return m_dMin;
+        }
+        /**
+        * @brief        최대값을 반환하는 함수
+        * @return       최대값 (데이터가 없으면 -inf)
+        */
+        double GetMax() const noexcept
+        {
+            return m_dMax;
+        }
+
+    private:
+        void Merge(uint64_t nCount, double dMean, double dM2, double dMin, double dMax) noexcept
+        {
+            if (nCount == 0)
+            {
+                return;
+            }
+            if (m_nCount == 0)
+            {
+                m_nCount = nCount;
+                m_dMean = dMean;
+                m_dM2 = dM2;
+                m_dMin = dMin;
+                m_dMax = dMax;
+                return;
+            }
+
+            double dCountA = static_cast<double>(m_nCount);
+            double dCountB = static_cast<double>(nCount);
+            double dTotal = dCountA + dCountB;
+            double dDelta = dMean - m_dMean;
+
+            m_nCount += nCount;
+            m_dMean += dDelta * (dCountB / dTotal);
+            m_dM2 += dM2 + dDelta * dDelta * (dCountA * dCountB / dTotal);
+            m_dMin = dMin < m_dMin ? dMin : m_dMin;
+            m_dMax = dMax > m_dMax ? dMax : m_dMax;
+        }
+
+        uint64_t m_nCount = 0;
+        double m_dMean = 0.0;
+        double m_dM2 = 0.0;
+        double m_dMin = std::numeric_limits<double>::infinity();
+        double m_dMax = -std::numeric_limits<double>::infinity();
+    };
+
+    /**
+    * @brief        지수 가중 이동 평균(EWMA)을 계산하는 클래스
+    * @details      s = alpha * x + (1 - alpha) * s (첫 데이터는 그대로 사용)
+    */
+    class Ewma
+    {
+    public:
+        /**
+        * @brief        생성자
+        * @param[in]    dAlpha          평활 계수 (0 < dAlpha <= 1, 범위를 벗어나면 std::invalid_argument 예외 발생)
+        */
+        explicit Ewma(double dAlpha)
+            : m_dAlpha(dAlpha)
+        {
+            if (!(dAlpha > 0.0 && dAlpha <= 1.0))
+            {
+                throw std::invalid_argument("alpha is out of range.");
+            }
+        }
+
+        void Add(double dValue) noexcept
+        {
+            if (m_bIsEmpty)
+            {
+                m_dValue = dValue;
+                m_bIsEmpty = false;
+                return;
+            }
+            m_dValue += m_dAlpha * (dValue - m_dValue);
+        }
+        /**
+        * @brief        데이터 배열을 순서대로 추가하는 함수 (점화식이라 벡터 연산 불가)
+        * @param[in]    pData           추가할 데이터 배열
+        * @param[in]    nCount          배열의 길이
+        */
+        void Add(const double* pData, size_t nCount) noexcept
+        {
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                Add(pData[i]);
+            }
+        }
+        void Reset() noexcept
+        {
+            m_dValue = 0.0;
+            m_bIsEmpty = true;
+        }
+
+        double Get() const noexcept
+        {
+            return m_dValue;
+        }
+        bool IsEmpty() const noexcept
+        {
+            return m_bIsEmpty;
+        }
+
+    private:
+        double m_dAlpha;
+        double m_dValue = 0.0;
+        bool m_bIsEmpty = true;
+    };
+
+    /**
+    * @brief        t-digest 기반으로 분위수(백분위)를 근사 계산하는 클래스
+    * @details      압축 계수에 비례하는 고정 크기의 메모리만 사용하며, 스레드별로 누적한 뒤 Merge 함수로 합칠 수 있음
+    *               꼬리(0%, 100% 근처) 분위수일수록 오차가 작음
+    */
+    class TDigest
+    {
+    public:
+        /**
+        * @brief        생성자
+        * @param[in]    dCompression    압축 계수 (클수록 정확하지만 메모리 증가, 기본 100 -> 최대 약 200개 중심점)
+        */
+        explicit TDigest(double dCompression = 100.0)
+            : m_dCompression(dCompression < 20.0 ? 20.0 : dCompression)
+            , m_nBufferLimit((static_cast<size_t>(2.0 * m_dCompression) + 8) * BUFFER_FACTOR)
+        {
+            size_t nCentroids = static_cast<size_t>(2.0 * m_dCompression) + 8;
+            m_vCentroids.reserve(nCentroids);
+            m_vBuffer.reserve(m_nBufferLimit);
+            m_vMerge.reserve(nCentroids * (BUFFER_FACTOR + 1));
+        }
+
+        /**
+        * @brief        데이터를 추가하는 함수
+        * @param[in]    dValue          추가할 데이터
+        * @param[in]    dWeight         가중치 (데이터 개수)
+        */
+        void Add(double dValue, double dWeight = 1.0)
+        {
+            if (std::isnan(dValue) ||
+                dWeight <= 0.0)
+            {
+                return;
+            }
+
+            m_dMin = dValue < m_dMin ? dValue : m_dMin;
+            m_dMax = dValue > m_dMax ? dValue : m_dMax;
+            m_dTotalWeight += dWeight;
+            m_vBuffer.push_back(Centroid{ dValue, dWeight });
+            // capacity는 복사/이동 시 보장되지 않으므로 생성 시 정한 한도로 비교
+            if (m_vBuffer.size() >= m_nBufferLimit)
+            {
+                Flush();
+            }
+        }
+        /**
+        * @brief        데이터 배열을 한 번에 추가하는 함수
+        * @param[in]    pData           추가할 데이터 배열
+        * @param[in]    nCount          배열의 길이
+        */
+        void Add(const double* pData, size_t nCount)
+        {
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                Add(pData[i]);
+            }
+        }
+        /**
+        * @brief        다른 t-digest를 합치는 함수
+        * @param[in]    other           합칠 t-digest
+        */
+        void Merge(const TDigest& other)
+        {
+            if (&other == this)
+            {
+                // Add가 두 벡터를 고치므로 자기 자신은 복사본으로 합침
+                const TDigest copy(other);
+                Merge(copy);
+                return;
+            }
+            for (const Centroid& centroid : other.m_vCentroids)
+            {
+                Add(centroid.dMean, centroid.dWeight);
+            }
+            for (const Centroid& centroid : other.m_vBuffer)
+            {
+                Add(centroid.dMean, centroid.dWeight);
+            }
+            // 중심점 평균 사이에 있던 실제 최소/최대값 반영
+            m_dMin = other.m_dMin < m_dMin ? other.m_dMin : m_dMin;
+            m_dMax = other.m_dMax > m_dMax ? other.m_dMax : m_dMax;
+        }
+        void Reset() noexcept
+        {
+            m_vCentroids.clear();
+            m_vBuffer.clear();
+            m_dTotalWeight = 0.0;
+            m_dMin = std::numeric_limits<double>::infinity();
+            m_dMax = -std::numeric_limits<double>::infinity();
+        }
+
+        /**
+        * @brief        분위수를 반환하는 함수 (대기 중인 데이터를 먼저 압축함)
+        * @param[in]    dQuantile       분위 (0.0 ~ 1.0, 예: p99 -> 0.99)
+        * @return       분위수 (데이터가 없으면 NaN)
+        */
+        double GetQuantile(double dQuantile)
+        {
+            Flush();
+            if (m_vCentroids.empty())
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (m_vCentroids.size() == 1)
+            {
+                return m_vCentroids.front().dMean;
+            }
+
+            dQuantile = dQuantile < 0.0 ? 0.0 : (dQuantile > 1.0 ? 1.0 : dQuantile);
+            double dIndex = dQuantile * m_dTotalWeight;
+
+            // 첫 중심점의 절반 이전은 최소값과 선형 보간
+            const Centroid& first = m_vCentroids.front();
+            if (dIndex < first.dWeight * 0.5)
+            {
+                return m_dMin + (dIndex / (first.dWeight * 0.5)) * (first.dMean - m_dMin);
+            }
+
+            double dWeightSoFar = first.dWeight * 0.5;
+            for (size_t i = 0; i + 1 < m_vCentroids.size(); ++i)
+            {
+                const Centroid& left = m_vCentroids[i];
+                const Centroid& right = m_vCentroids[i + 1];
+                double dGap = (left.dWeight + right.dWeight) * 0.5;
+                if (dWeightSoFar + dGap > dIndex)
+                {
+                    double dRatio = (dIndex - dWeightSoFar) / dGap;
+                    return left.dMean + dRatio * (right.dMean - left.dMean);
+                }
+                dWeightSoFar += dGap;
+            }
+
+            // 마지막 중심점의 절반 이후는 최대값과 선형 보간
+            const Centroid& last = m_vCentroids.back();
+            double dRatio = (dIndex - dWeightSoFar) / (last.dWeight * 0.5);
+            dRatio = dRatio > 1.0 ? 1.0 : dRatio;
+            return last.dMean + dRatio * (m_dMax - last.dMean);
+        }
+        double GetCount() const noexcept
+        {
+            return m_dTotalWeight;
+        }
+        double GetMin() const noexcept
+        {
+            return m_dMin;
+        }
+        double GetMax() const noexcept
+        {
+            return m_dMax;
+        }
+
+    private:
+        static constexpr size_t BUFFER_FACTOR = 5;     // 압축 전 버퍼 크기 (중심점 최대 개수의 배수)
+        static constexpr double PI = 3.14159265358979323846;
+
+        struct Centroid
+        {
+            double dMean;
+            double dWeight;
+        };
+
+        /**
+        * @brief        버퍼의 데이터를 중심점과 합쳐 다시 압축하는 함수 (scale function k1)
+        */
+        void Flush()
+        {
+            if (m_vBuffer.empty())
+            {
+                return;
+            }
+
+            m_vMerge.clear();
+            m_vMerge.insert(m_vMerge.end(), m_vCentroids.begin(), m_vCentroids.end());
+            m_vMerge.insert(m_vMerge.end(), m_vBuffer.begin(), m_vBuffer.end());
+            m_vBuffer.clear();
+            std::sort(m_vMerge.begin(), m_vMerge.end(),
+                [](const Centroid& a, const Centroid& b) { return a.dMean < b.dMean; });
+
+            double dTotal = 0.0;
+            for (const Centroid& centroid : m_vMerge)
+            {
+                dTotal += centroid.dWeight;
+            }
+
+            m_vCentroids.clear();
+            Centroid current = m_vMerge.front();
+            double dWeightSoFar = 0.0;
+            double dWeightLimit = dTotal * QuantileOfScale(ScaleOfQuantile(0.0) + 1.0);
+            for (size_t i = 1; i < m_vMerge.size(); ++i)
+            {
+                const Centroid& next = m_vMerge[i];
+                if (dWeightSoFar + current.dWeight + next.dWeight <= dWeightLimit)
+                {
+                    current.dWeight += next.dWeight;
+                    current.dMean += (next.dMean - current.dMean) * (next.dWeight / current.dWeight);
+                }
+                else
+                {
+                    dWeightSoFar += current.dWeight;
+                    m_vCentroids.push_back(current);
+                    current = next;
+                    dWeightLimit = dTotal * QuantileOfScale(ScaleOfQuantile(dWeightSoFar / dTotal) + 1.0);
+                }
+            }
+            m_vCentroids.push_back(current);
+        }
+        double ScaleOfQuantile(double dQuantile) const noexcept
+        {
+            return m_dCompression / (2.0 * PI) * std::asin(2.0 * dQuantile - 1.0);
+        }
+        double QuantileOfScale(double dScale) const noexcept
+        {
+            double dAngle = dScale * (2.0 * PI) / m_dCompression;
+            dAngle = dAngle > PI * 0.5 ? PI * 0.5 : dAngle;
+            return (1.0 + std::sin(dAngle)) * 0.5;
+        }
+
+        double m_dCompression;
+        size_t m_nBufferLimit;                  // 압축 전 버퍼에 쌓을 최대 데이터 수
+        double m_dTotalWeight = 0.0;
+        double m_dMin = std::numeric_limits<double>::infinity();
+        double m_dMax = -std::numeric_limits<double>::infinity();
+        std::vector<Centroid> m_vCentroids;     // 압축된 중심점 (평균 오름차순)
+        std::vector<Centroid> m_vBuffer;        // 압축 대기 중인 데이터
+        std::vector<Centroid> m_vMerge;         // 압축 작업용 버퍼 (재할당 방지)
+    };
+
+    /**
+    * @brief        고정 소수점 연산 결과가 표현 범위를 벗어났을 때의 처리 방식
+    */
+    enum class eFixedOverflow
+    {
+        Saturate = 0,       /* 최대/최소값으로 고정 */
+        Wrap,               /* 상위 비트를 버림 (2의 보수 순환) */
+    };
+
+    /**
+    * @brief        2진 고정 소수점 클래스 (Q 포맷, 값 = Raw / 2^FRAC_BITS)
+    * @details      부동 소수점 없이 정수 연산만 사용하므로 플랫폼과 무관하게 결과가 동일함
+    *               곱셈은 내림(floor), 나눗셈은 0 방향 버림, 0으로 나누면 부호에 따라 최대/최소값 (0 / 0 = 0)
+    * @tparam       INT_BITS        정수부 비트 수 (부호 비트 포함, 1 이상)
+    * @tparam       FRAC_BITS       소수부 비트 수 (0 ~ 60)
+    * @tparam       OVERFLOW_MODE        범위 초과 처리 방식
+    */
+    template <int INT_BITS, int FRAC_BITS, eFixedOverflow OVERFLOW_MODE = eFixedOverflow::Saturate>
+    class Fixed
+    {
+        static_assert(INT_BITS >= 1, "정수부는 부호 비트를 포함하여 1비트 이상");
+        static_assert(FRAC_BITS >= 0 && FRAC_BITS <= 60, "소수부는 0 ~ 60비트");
+        static_assert(INT_BITS + FRAC_BITS <= 64, "전체 비트 수는 64 이하");
+
+    public:
+        using RawType = std::conditional_t<(INT_BITS + FRAC_BITS <= 32), int32_t, int64_t>;
+
+        static constexpr int TOTAL_BITS = INT_BITS + FRAC_BITS;
+        static constexpr int64_t RAW_MAX = TOTAL_BITS == 64 ? (std::numeric_limits<int64_t>::max)() : (int64_t(1) << (TOTAL_BITS - 1)) - 1;
+        static constexpr int64_t RAW_MIN = -RAW_MAX - 1;
+        static constexpr int64_t RAW_ONE = int64_t(1) << FRAC_BITS;
+        /**
+        * @brief        문자열로 변환 후 다시 읽었을 때 같은 값이 되는 최소 소수점 자리수
+        */
+        static constexpr int DEFAULT_DIGITS = []()
+        {
+            int nDigits = 0;
+            uint64_t nPow10 = 1;
+            while (nPow10 <= (uint64_t(1) << (FRAC_BITS + 1)) && FRAC_BITS > 0)
+            {
+                nPow10 *= 10;
+                ++nDigits;
+            }
+            return nDigits;
+        }();
+
+        constexpr Fixed() noexcept
+            : m_nRaw(0)
+        {
+        }
+
+        /**
+        * @brief        내부 값(Raw)으로 생성하는 함수 (범위 검사 없음)
+        */
+        static constexpr Fixed FromRaw(RawType nRaw) noexcept
+        {
+            Fixed fixed;
+            fixed.m_nRaw = nRaw;
+            return fixed;
+        }
+        /**
+        * @brief        정수로 생성하는 함수
+        */
+        static constexpr Fixed FromInt(int64_t nValue) noexcept
+        {
+            bool bIsOverflow = nValue > (RAW_MAX >> FRAC_BITS) || nValue < (RAW_MIN >> FRAC_BITS);
+            int64_t nWide = static_cast<int64_t>(static_cast<uint64_t>(nValue) << FRAC_BITS);
+            return FromRaw(Narrow(nWide, bIsOverflow, nValue >= 0));
+        }
+        /**
+        * @brief        실수로 생성하는 함수 (반올림, NaN은 0)
+        */
+        static constexpr Fixed FromDouble(double dValue) noexcept
+        {
+            if (dValue != dValue)
+            {
+                return Fixed();
+            }
+
+            double dScaled = dValue * static_cast<double>(RAW_ONE);
+            dScaled = dScaled >= 0.0 ? dScaled + 0.5 : dScaled - 0.5;
+            // 2^63 이상은 int64_t로 변환할 수 없으므로 미리 판정
+            if (dScaled >= 9223372036854775808.0)
+            {
+                return FromRaw(Narrow(0, true, true));
+            }
+            if (dScaled <= -9223372036854775808.0)
+            {
+                return FromRaw(Narrow(0, true, false));
+            }
+            return FromRaw(Narrow(static_cast<int64_t>(dScaled), false, dScaled >= 0.0));
+        }
+        /**
+        * @brief        10진 스케일 정수로 생성하는 함수 (예: 0.01 단위 센서값 -> FromDecimal<100>(nValue))
+        * @details      정수부는 DivConst로 나누고 나머지만 소수부로 변환하므로 정확함 (0 방향 버림)
+        * @tparam       N               스케일 (10, 100, 1000 등)
+        */
+        template <int64_t N>
+        static constexpr Fixed FromDecimal(int64_t nScaled) noexcept
+        {
+            static_assert(N > 0 && N <= ((std::numeric_limits<int64_t>::max)() >> FRAC_BITS), "N * 2^FRAC_BITS 가 int64_t 범위를 벗어남");
+            int64_t nQuot = DivConst<N>::Div(nScaled);
+            int64_t nRem = nScaled - nQuot * N;
+            bool bIsOverflow = nQuot > (RAW_MAX >> FRAC_BITS) || nQuot < (RAW_MIN >> FRAC_BITS);
+            int64_t nWide = static_cast<int64_t>(static_cast<uint64_t>(nQuot) << FRAC_BITS) +
+                DivConst<N>::Div(static_cast<int64_t>(static_cast<uint64_t>(nRem) << FRAC_BITS));
+            bIsOverflow = bIsOverflow || nWide > RAW_MAX || nWide < RAW_MIN;
+            return FromRaw(Narrow(nWide, bIsOverflow, nScaled >= 0));
+        }
+
+        constexpr RawType GetRaw() const noexcept
+        {
+            return m_nRaw;
+        }
+        constexpr double ToDouble() const noexcept
+        {
+            return static_cast<double>(m_nRaw) / static_cast<double>(RAW_ONE);
+        }
+        /**
+        * @brief        정수부를 반환하는 함수 (0 방향 버림)
+        */
+        constexpr int64_t ToInt() const noexcept
+        {
+            uint64_t nAbs = detail::AbsToUnsigned(m_nRaw) >> FRAC_BITS;
+            return m_nRaw < 0 ? -static_cast<int64_t>(nAbs) : static_cast<int64_t>(nAbs);
+        }
+        /**
+        * @brief        10진 스케일 정수로 변환하는 함수 (예: 0.01 단위 -> ToDecimal<100>(), 반올림)
+        * @tparam       N               스케일 (10, 100, 1000 등)
+        */
+        template <int64_t N>
+        constexpr int64_t ToDecimal() const noexcept
+        {
+            static_assert(N > 0 && N <= ((std::numeric_limits<int64_t>::max)() >> FRAC_BITS), "N * 2^FRAC_BITS 가 int64_t 범위를 벗어남");
+            int64_t nInt = m_nRaw >> FRAC_BITS;
+            int64_t nFrac = m_nRaw & (RAW_ONE - 1);
+            return nInt * N + ((nFrac * N + (RAW_ONE >> 1)) >> FRAC_BITS);
+        }
+
+        /**
+        * @brief        10진 문자열로 변환하는 함수 (예: "-12.375")
+        * @param[out]   pszBuffer       문자열 버퍼 (null 문자 포함)
+        * @param[in]    nBufferSize     버퍼의 크기
+        * @param[in]    nDigits         소수점 이하 자리수 (반올림, 음수인 경우 DEFAULT_DIGITS)
+        * @return       기록한 문자열의 길이 (버퍼가 부족하면 0)
+        */
+        size_t ToChars(char* pszBuffer, size_t nBufferSize, int nDigits = -1) const noexcept
+        {
+            if (pszBuffer == nullptr ||
+                nBufferSize == 0)
+            {
+                return 0;
+            }
+
+            const int MAX_DIGITS = 32;
+            nDigits = nDigits < 0 ? DEFAULT_DIGITS : (nDigits > MAX_DIGITS ? MAX_DIGITS : nDigits);
+
+            const uint64_t FRAC_MASK = static_cast<uint64_t>(RAW_ONE - 1);
+            uint64_t nAbs = detail::AbsToUnsigned(m_nRaw);
+            uint64_t nInt = nAbs >> FRAC_BITS;
+            uint64_t nFrac = nAbs & FRAC_MASK;
+
+            char szFrac[MAX_DIGITS] = { 0, };
+            bool bIsNonZero = nInt != 0;
+            for (int i = 0; i < nDigits; ++i)
+            {
+                nFrac *= 10;
+                szFrac[i] = static_cast<char>('0' + (nFrac >> FRAC_BITS));
+                nFrac &= FRAC_MASK;
+            }
+
+            // 남은 값이 0.5 이상이면 올림
+            if (FRAC_BITS > 0 &&
+                nFrac >= (static_cast<uint64_t>(RAW_ONE) >> 1))
+            {
+                int i = nDigits - 1;
+                for (; i >= 0 && szFrac[i] == '9'; --i)
+                {
+                    szFrac[i] = '0';
+                }
+                if (i >= 0)
+                {
+                    ++szFrac[i];
+                }
+                else
+                {
+                    ++nInt;
+                }
+            }
+            for (int i = 0; i < nDigits && !bIsNonZero; ++i)
+            {
+                bIsNonZero = szFrac[i] != '0';
+            }
+            bIsNonZero = bIsNonZero || nInt != 0;
+
+            char szInt[24] = { 0, };
+            std::to_chars_result result = std::to_chars(szInt, szInt + sizeof(szInt), nInt);
+            size_t nIntLength = static_cast<size_t>(result.ptr - szInt);
+
+            bool bIsNegative = m_nRaw < 0 && bIsNonZero;
+            size_t nLength = (bIsNegative ? 1 : 0) + nIntLength + (nDigits > 0 ? 1 + static_cast<size_t>(nDigits) : 0);
+            if (nLength + 1 > nBufferSize)
+            {
+                return 0;
+            }
+
+            char* pCh = pszBuffer;
+            if (bIsNegative)
+            {
+                *pCh++ = '-';
+            }
+            ::memcpy(pCh, szInt, nIntLength);
+            pCh += nIntLength;
+            if (nDigits > 0)
+            {
+                *pCh++ = '.';
+                ::memcpy(pCh, szFrac, static_cast<size_t>(nDigits));
+                pCh += nDigits;
+            }
+            *pCh = '\0';
+            return nLength;
+        }
+        /**
+        * @brief        10진 문자열을 읽어 변환하는 함수 (예: "-12.375", 지수 표기 미지원, 소수부는 반올림)
+        * @param[in]    pFirst          문자열의 시작
+        * @param[in]    pLast           문자열의 끝 (마지막 문자의 다음 위치)
+        * @param[out]   pOut            변환 결과 (범위를 벗어나면 OVERFLOW_MODE 방식에 따라 처리)
+        * @return       true: 성공, false: 형식 오류
+        */
+        static bool FromChars(const char* pFirst, const char* pLast, Fixed* pOut) noexcept
+        {
+            if (pFirst == nullptr ||
+                pLast == nullptr ||
+                pOut == nullptr)
+            {
+                return false;
+            }
+
+            const char* pCh = pFirst;
+            bool bIsNegative = false;
+            if (pCh < pLast &&
+                (*pCh == '-' || *pCh == '+'))
+            {
+                bIsNegative = *pCh == '-';
+                ++pCh;
+            }
+
+            uint64_t nInt = 0;
+            bool bIsOverflow = false;
+            int nDigitCount = 0;
+            for (; pCh < pLast && *pCh >= '0' && *pCh <= '9'; ++pCh, ++nDigitCount)
+            {
+                if (nInt > ((std::numeric_limits<uint64_t>::max)() - 9) / 10)
+                {
+                    bIsOverflow = true;
+                    continue;
+                }
+                nInt = nInt * 10 + static_cast<uint64_t>(*pCh - '0');
+            }
+
+            const char* pFracFirst = pCh;
+            const char* pFracLast = pCh;
+            if (pCh < pLast &&
+                *pCh == '.')
+            {
+                pFracFirst = ++pCh;
+                for (; pCh < pLast && *pCh >= '0' && *pCh <= '9'; ++pCh, ++nDigitCount)
+                {
+                }
+                pFracLast = pCh;
+            }
+            if (nDigitCount == 0 ||
+                pCh != pLast)
+            {
+                return false;
+            }
+
+            // 뒤쪽 자리부터 (acc + digit) / 10 을 반복 (2^-FRAC_BITS 보다 작은 자리는 보호 비트로 유지)
+            const int MAX_FRAC_DIGITS = 20;
+            const int GUARD_BITS = (60 - FRAC_BITS) < 3 ? (60 - FRAC_BITS) : 3;
+            if (pFracLast - pFracFirst > MAX_FRAC_DIGITS)
+            {
+                pFracLast = pFracFirst + MAX_FRAC_DIGITS;
+            }
+            uint64_t nAcc = 0;
+            for (const char* pDigit = pFracLast; pDigit > pFracFirst; )
+            {
+                --pDigit;
+                nAcc = (nAcc + (static_cast<uint64_t>(*pDigit - '0') << (FRAC_BITS + GUARD_BITS))) / 10;
+            }
+            uint64_t nFrac = GUARD_BITS > 0 ? (nAcc + (uint64_t(1) << (GUARD_BITS - 1))) >> GUARD_BITS : nAcc;
+
+            uint64_t nLimit = bIsNegative ? static_cast<uint64_t>(RAW_MAX) + 1 : static_cast<uint64_t>(RAW_MAX);
+            uint64_t nAbs = 0;
+            if (bIsOverflow ||
+                nInt > (uint64_t(1) << (63 - FRAC_BITS)))
+            {
+                bIsOverflow = true;
+            }
+            else
+            {
+                nAbs = (nInt << FRAC_BITS) + nFrac;
+                bIsOverflow = nAbs > nLimit;
+            }
+
+            int64_t nWide = static_cast<int64_t>(bIsNegative ? 0 - nAbs : nAbs);
+            *pOut = FromRaw(Narrow(nWide, bIsOverflow, !bIsNegative));
+            return true;
+        }
+        /**
+        * @brief        10진 문자열을 읽어 변환하는 함수 (null 종료 문자열)
+        */
+        static bool FromChars(const char* pszText, Fixed* pOut) noexcept
+        {
+            if (pszText == nullptr)
+            {
+                return false;
+            }
+            return FromChars(pszText, pszText + ::strlen(pszText), pOut);
+        }
+
+        /**
+        * @brief        배열의 원소별 덧셈을 수행하는 함수 (32비트 이하는 AVX2/NEON 사용 가능 시 벡터 연산)
+        * @param[in]    pA              배열1
+        * @param[in]    pB              배열2
+        * @param[out]   pOut            결과 배열 (pA 또는 pB와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        */
+        static void Add(const Fixed* pA, const Fixed* pB, Fixed* pOut, size_t nCount) noexcept
+        {
+            size_t i = 0;
+            if constexpr (std::is_same_v<RawType, int32_t>)
+            {
+#if defined(ESK_SIMD_AVX2)
+                for (; i + 8 <= nCount; i += 8)
+                {
+                    __m256i vA = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pA + i));
+                    __m256i vB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pB + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pOut + i), AddVector(vA, vB));
+                }
+#elif defined(ESK_SIMD_NEON)
+                for (; i + 4 <= nCount; i += 4)
+                {
+                    int32x4_t vA = vld1q_s32(reinterpret_cast<const int32_t*>(pA + i));
+                    int32x4_t vB = vld1q_s32(reinterpret_cast<const int32_t*>(pB + i));
+                    vst1q_s32(reinterpret_cast<int32_t*>(pOut + i), AddVector(vA, vB));
+                }
+#endif
+            }
+            for (; i < nCount; ++i)
+            {
+                pOut[i] = pA[i] + pB[i];
+            }
+        }
+        /**
+        * @brief        배열의 원소별 곱셈을 수행하는 함수 (32비트 이하는 AVX2/NEON 사용 가능 시 벡터 연산)
+        * @param[in]    pA              배열1
+        * @param[in]    pB              배열2
+        * @param[out]   pOut            결과 배열 (pA 또는 pB와 같아도 됨)
+        * @param[in]    nCount          배열의 길이
+        */
+        static void Mul(const Fixed* pA, const Fixed* pB, Fixed* pOut, size_t nCount) noexcept
+        {
+            size_t i = 0;
+            if constexpr (std::is_same_v<RawType, int32_t>)
+            {
+#if defined(ESK_SIMD_AVX2)
+                for (; i + 8 <= nCount; i += 8)
+                {
+                    __m256i vA = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pA + i));
+                    __m256i vB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pB + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pOut + i), MulVector(vA, vB));
+                }
+#elif defined(ESK_SIMD_NEON)
+                for (; i + 4 <= nCount; i += 4)
+                {
+                    int32x4_t vA = vld1q_s32(reinterpret_cast<const int32_t*>(pA + i));
+                    int32x4_t vB = vld1q_s32(reinterpret_cast<const int32_t*>(pB + i));
+                    vst1q_s32(reinterpret_cast<int32_t*>(pOut + i), MulVector(vA, vB));
+                }
+#endif
+            }
+            for (; i < nCount; ++i)
+            {
+                pOut[i] = pA[i] * pB[i];
+            }
+        }
+
+        constexpr Fixed operator+(const Fixed& in) const noexcept
+        {
+            int64_t nA = m_nRaw;
+            int64_t nB = in.m_nRaw;
+            int64_t nSum = static_cast<int64_t>(static_cast<uint64_t>(nA) + static_cast<uint64_t>(nB));
+            bool bIsOverflow = ((nA ^ nSum) & (nB ^ nSum)) < 0;
+            return FromRaw(Narrow(nSum, bIsOverflow, nA >= 0));
+        }
+        constexpr Fixed operator-(const Fixed& in) const noexcept
+        {
+            int64_t nA = m_nRaw;
+            int64_t nB = in.m_nRaw;
+            int64_t nDiff = static_cast<int64_t>(static_cast<uint64_t>(nA) - static_cast<uint64_t>(nB));
+            bool bIsOverflow = ((nA ^ nB) & (nA ^ nDiff)) < 0;
+            return FromRaw(Narrow(nDiff, bIsOverflow, nA >= 0));
+        }
+        constexpr Fixed operator-() const noexcept
+        {
+            return Fixed() - *this;
+        }
+        constexpr Fixed operator*(const Fixed& in) const noexcept
+        {
+            if constexpr (std::is_same_v<RawType, int32_t>)
+            {
+                int64_t nProduct = static_cast<int64_t>(m_nRaw) * in.m_nRaw;
+                return FromRaw(Narrow(nProduct >> FRAC_BITS, false, nProduct >= 0));
+            }
+            else
+            {
+                // 128비트 곱의 크기를 구한 뒤 부호 적용 (음수는 내림이 되도록 크기를 올림)
+                uint64_t nA = detail::AbsToUnsigned(m_nRaw);
+                uint64_t nB = detail::AbsToUnsigned(in.m_nRaw);
+                bool bIsNegative = (m_nRaw < 0) != (in.m_nRaw < 0);
+                uint64_t nHigh = detail::MulHiU64(nA, nB);
+                uint64_t nLow = nA * nB;
+                uint64_t nQuotLow = nLow;
+                uint64_t nQuotHigh = nHigh;
+                if constexpr (FRAC_BITS > 0)
+                {
+                    nQuotLow = (nLow >> FRAC_BITS) | (nHigh << (64 - FRAC_BITS));
+                    nQuotHigh = nHigh >> FRAC_BITS;
+                    if (bIsNegative &&
+                        (nLow & static_cast<uint64_t>(RAW_ONE - 1)) != 0)
+                    {
+                        ++nQuotLow;
+                        nQuotHigh += nQuotLow == 0 ? 1 : 0;
+                    }
+                }
+
+                uint64_t nLimit = bIsNegative ? static_cast<uint64_t>(RAW_MAX) + 1 : static_cast<uint64_t>(RAW_MAX);
+                bool bIsOverflow = nQuotHigh != 0 || nQuotLow > nLimit;
+                int64_t nWide = static_cast<int64_t>(bIsNegative ? 0 - nQuotLow : nQuotLow);
+                return FromRaw(Narrow(nWide, bIsOverflow, !bIsNegative));
+            }
+        }
+        constexpr Fixed operator/(const Fixed& in) const noexcept
+        {
+            if (in.m_nRaw == 0)
+            {
+                return m_nRaw == 0 ? Fixed() : FromRaw(static_cast<RawType>(m_nRaw > 0 ? RAW_MAX : RAW_MIN));
+            }
+
+            if constexpr (std::is_same_v<RawType, int32_t>)
+            {
+                int64_t nQuot = (static_cast<int64_t>(m_nRaw) * RAW_ONE) / in.m_nRaw;
+                return FromRaw(Narrow(nQuot, false, nQuot >= 0));
+            }
+            else
+            {
+                uint64_t nA = detail::AbsToUnsigned(m_nRaw);
+                uint64_t nB = detail::AbsToUnsigned(in.m_nRaw);
+                bool bIsNegative = (m_nRaw < 0) != (in.m_nRaw < 0);
+                uint64_t nHigh = FRAC_BITS > 0 ? nA >> ((64 - FRAC_BITS) & 63) : 0;
+                uint64_t nLow = nA << FRAC_BITS;
+
+                uint64_t nLimit = bIsNegative ? static_cast<uint64_t>(RAW_MAX) + 1 : static_cast<uint64_t>(RAW_MAX);
+                // 몫의 상위 64비트가 0이 아니면 범위 초과 (Wrap 방식을 위해 하위 64비트는 항상 계산)
+                uint64_t nQuotHigh = nHigh / nB;
+                uint64_t nQuot = detail::DivWide(nHigh % nB, nLow, nB);
+                bool bIsOverflow = nQuotHigh != 0 || nQuot > nLimit;
+                int64_t nWide = static_cast<int64_t>(bIsNegative ? 0 - nQuot : nQuot);
+                return FromRaw(Narrow(nWide, bIsOverflow, !bIsNegative));
+            }
+        }
+
+        constexpr Fixed& operator+=(const Fixed& in) noexcept
+        {
+            *this = *this + in;
+            return *this;
+        }
+        constexpr Fixed& operator-=(const Fixed& in) noexcept
+        {
+            *this = *this - in;
+            return *this;
+        }
+        constexpr Fixed& operator*=(const Fixed& in) noexcept
+        {
+            *this = *this * in;
+            return *this;
+        }
+        constexpr Fixed& operator/=(const Fixed& in) noexcept
+        {
+            *this = *this / in;
+            return *this;
+        }
+
+        constexpr bool operator==(const Fixed& in) const noexcept
+        {
+            return m_nRaw == in.m_nRaw;
+        }
+        constexpr bool operator!=(const Fixed& in) const noexcept
+        {
+            return m_nRaw != in.m_nRaw;
+        }
+        constexpr bool operator<(const Fixed& in) const noexcept
+        {
+            return m_nRaw < in.m_nRaw;
+        }
+        constexpr bool operator>(const Fixed& in) const noexcept
+        {
+            return m_nRaw > in.m_nRaw;
+        }
+        constexpr bool operator<=(const Fixed& in) const noexcept
+        {
+            return m_nRaw <= in.m_nRaw;
+        }
+        constexpr bool operator>=(const Fixed& in) const noexcept
+        {
+            return m_nRaw >= in.m_nRaw;
+        }
+
+    private:
+        /**
+        * @brief        연산 결과를 전체 비트 수에 맞게 정리하는 함수
+        * @param[in]    nWide           연산 결과 (bIsOverflow == true 이면 하위 64비트)
+        * @param[in]    bIsOverflow     연산 결과가 int64_t 범위 또는 표현 범위를 벗어났는지 유무
+        * @param[in]    bIsPositive     범위를 벗어난 방향 (true: 양수)
+        */
+        static constexpr RawType Narrow(int64_t nWide, bool bIsOverflow, bool bIsPositive) noexcept
+        {
+            if constexpr (OVERFLOW_MODE == eFixedOverflow::Saturate)
+            {
+                if (bIsOverflow)
+                {
+                    return static_cast<RawType>(bIsPositive ? RAW_MAX : RAW_MIN);
+                }
+                return static_cast<RawType>(nWide > RAW_MAX ? RAW_MAX : (nWide < RAW_MIN ? RAW_MIN : nWide));
+            }
+            else
+            {
+                // 하위 TOTAL_BITS 비트만 남기고 부호 확장
+                return static_cast<RawType>(static_cast<int64_t>(static_cast<uint64_t>(nWide) << (64 - TOTAL_BITS)) >> (64 - TOTAL_BITS));
+            }
+        }
+
+#if defined(ESK_SIMD_AVX2)
+        static __m256i NarrowVector(__m256i vValue) noexcept
+        {
+            if constexpr (TOTAL_BITS < 32)
+            {
+                if constexpr (OVERFLOW_MODE == eFixedOverflow::Saturate)
+                {
+                    vValue = _mm256_min_epi32(vValue, _mm256_set1_epi32(static_cast<int32_t>(RAW_MAX)));
+                    vValue = _mm256_max_epi32(vValue, _mm256_set1_epi32(static_cast<int32_t>(RAW_MIN)));
+                }
+                else
+                {
+                    vValue = _mm256_srai_epi32(_mm256_slli_epi32(vValue, 32 - TOTAL_BITS), 32 - TOTAL_BITS);
+                }
+            }
+            return vValue;
+        }
+        static __m256i AddVector(__m256i vA, __m256i vB) noexcept
+        {
+            __m256i vSum = _mm256_add_epi32(vA, vB);
+            if constexpr (TOTAL_BITS == 32 && OVERFLOW_MODE == eFixedOverflow::Saturate)
+            {
+                // 두 피연산자와 결과의 부호가 다르면 overflow -> a의 부호에 따라 최대/최소값
+                __m256i vOverflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(vA, vSum), _mm256_xor_si256(vB, vSum)), 31);
+                __m256i vSaturate = _mm256_xor_si256(_mm256_srai_epi32(vA, 31), _mm256_set1_epi32((std::numeric_limits<int32_t>::max)()));
+                vSum = _mm256_blendv_epi8(vSum, vSaturate, vOverflow);
+            }
+            return NarrowVector(vSum);
+        }
+        static __m256i MulProductVector(__m256i vProduct) noexcept
+        {
+            __m256i vQuot = _mm256_srli_epi64(vProduct, FRAC_BITS);
+            if constexpr (OVERFLOW_MODE == eFixedOverflow::Saturate)
+            {
+                // 하위 32비트만 사용하므로 논리 시프트 결과를 범위 비교로 보정
+                const __m256i vUpper = _mm256_set1_epi64x(((RAW_MAX + 1) << FRAC_BITS) - 1);
+                const __m256i vLower = _mm256_set1_epi64x(RAW_MIN * RAW_ONE);
+                vQuot = _mm256_blendv_epi8(vQuot, _mm256_set1_epi64x(RAW_MAX), _mm256_cmpgt_epi64(vProduct, vUpper));
+                vQuot = _mm256_blendv_epi8(vQuot, _mm256_set1_epi64x(RAW_MIN), _mm256_cmpgt_epi64(vLower, vProduct));
+            }
+            return vQuot;
+        }
+        static __m256i MulVector(__m256i vA, __m256i vB) noexcept
+        {
+            __m256i vEven = MulProductVector(_mm256_mul_epi32(vA, vB));
+            __m256i vOdd = MulProductVector(_mm256_mul_epi32(_mm256_srli_epi64(vA, 32), _mm256_srli_epi64(vB, 32)));
+            __m256i vResult = _mm256_blend_epi32(vEven, _mm256_slli_epi64(vOdd, 32), 0xAA);
+            if constexpr (OVERFLOW_MODE == eFixedOverflow::Wrap)
+            {
+                vResult = NarrowVector(vResult);
+            }
+            return vResult;
+        }
+#elif defined(ESK_SIMD_NEON)
+        static int32x4_t NarrowVector(int32x4_t vValue) noexcept
+        {
+            if constexpr (TOTAL_BITS < 32)
+            {
+                if constexpr (OVERFLOW_MODE == eFixedOverflow::Saturate)
+                {
+                    vValue = vminq_s32(vValue, vdupq_n_s32(static_cast<int32_t>(RAW_MAX)));
+                    vValue = vmaxq_s32(vValue, vdupq_n_s32(static_cast<int32_t>(RAW_MIN)));
+                }
+                else
+                {
+                    vValue = vshrq_n_s32(vshlq_n_s32(vValue, 32 - TOTAL_BITS), 32 - TOTAL_BITS);
+                }
+            }
+            return vValue;
+        }
+        static int32x4_t AddVector(int32x4_t vA, int32x4_t vB) noexcept
+        {
+            if constexpr (TOTAL_BITS == 32 && OVERFLOW_MODE == eFixedOverflow::Saturate)
+            {
+                return vqaddq_s32(vA, vB);
+            }
+            else
+            {
+                return NarrowVector(vaddq_s32(vA, vB));
+            }
+        }
+        static int32x2_t MulProductVector(int64x2_t vProduct) noexcept
+        {
+            if constexpr (OVERFLOW_MODE == eFixedOverflow::Saturate)
+            {
+                if constexpr (FRAC_BITS == 0)
+                {
+                    return vqmovn_s64(vProduct);
+                }
+                else
+                {
+                    return vqshrn_n_s64(vProduct, FRAC_BITS);
+                }
+            }
+            else
+            {
+                if constexpr (FRAC_BITS == 0)
+                {
+                    return vmovn_s64(vProduct);
+                }
+                else
+                {
+                    return vmovn_s64(vshrq_n_s64(vProduct, FRAC_BITS));
+                }
+            }
+        }
+        static int32x4_t MulVector(int32x4_t vA, int32x4_t vB) noexcept
+        {
+            int32x2_t vLow = MulProductVector(vmull_s32(vget_low_s32(vA), vget_low_s32(vB)));
+            int32x2_t vHigh = MulProductVector(vmull_s32(vget_high_s32(vA), vget_high_s32(vB)));
+            return NarrowVector(vcombine_s32(vLow, vHigh));
+        }
+#endif
+
+        RawType m_nRaw;
+    };
 } // namespace esk::util_calc
@@ -1,8 +1,8 @@
 ﻿/**
 * @file			Common.h
 * @author		yc.jeon (Eskeptor)
-* @date			2026-04-21
-* @version		0.0.3
+* @date			2026-10-18
+* @version		0.0.4
 * @brief		Common Definitions
 */
 
@@ -38,4 +38,25 @@
 
 #ifndef OUT
 	#define OUT
+#endif
+
+#if defined(__AVX512F__)
+	#ifndef ESK_SIMD_AVX512
+		#define ESK_SIMD_AVX512
+	#endif
+	#include <immintrin.h>
+#endif
+
+#if defined(__AVX2__)
+	#ifndef ESK_SIMD_AVX2
+		#define ESK_SIMD_AVX2
+	#endif
+	#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+	#ifndef ESK_SIMD_NEON
+		#define ESK_SIMD_NEON
+	#endif
+	#include <arm_neon.h>
 #endif
\ No newline at end of file
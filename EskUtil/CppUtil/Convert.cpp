@@ -1,13 +1,22 @@
 ﻿/**
 * @file			Convert.cpp
 * @author		yc.jeon (Eskeptor)
-* @date			2026-04-21
-* @version		0.0.2
+* @date			2026-10-18
+* @version		0.0.4
 * @brief		Convert Utility
 */
 
 #include "Convert.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #define MAX(X, Y)		((X) > (Y) ? (X) : (Y))
 #define MIN(X, Y)		((X) > (Y) ? (Y) : (X))
@@ -210,4 +219,1111 @@ namespace esk::gearforge::util::conv
 
 		return RGBToHex(nR, nG, nB);
 	}
+
+	namespace
+	{
+		constexpr size_t MIN_TILE_PIXELS = 1 << 16;
+
+		/**
+		* @brief        스레드 생성이나 타일 처리 중 예외가 나도 이미 시작한 스레드를 join하는 가드
+		*/
+		struct ThreadJoinGuard
+		{
+			std::vector<std::thread>& vThreads;
+
+			~ThreadJoinGuard()
+			{
+				for (std::thread& thread : vThreads)
+				{
+					if (thread.joinable())
+					{
+						thread.join();
+					}
+				}
+			}
+		};
+
+		/**
+		* @brief        [nBegin, nEnd) 구간 함수를 타일 단위로 나누어 여러 스레드에서 실행
+		* @details      타일이 너무 작으면 스레드 생성 비용이 더 커지므로 MIN_TILE_PIXELS 이상으로만 나눈다.
+		*               첫 타일은 호출 스레드에서 직접 처리한다.
+		*/
+		template <typename FUNC>
+		void RunTiled(size_t nCount, int nThreadCount, FUNC func)
+		{
+			size_t nThreads = nThreadCount > 0 ? (size_t)nThreadCount : (size_t)std::thread::hardware_concurrency();
+			nThreads = MIN(nThreads, (nCount + MIN_TILE_PIXELS - 1) / MIN_TILE_PIXELS);
+			if (nThreads <= 1)
+			{
+				func(0, nCount);
+				return;
+			}
+
+			// SIMD 루프가 꼬리 처리 없이 돌 수 있도록 타일 경계를 8픽셀 단위로 맞춤
+			size_t nTile = ((nCount + nThreads - 1) / nThreads + 7) & ~(size_t)7;
+			// 작업 스레드의 예외는 모아 두었다가 join 후 호출 스레드에서 다시 던짐
+			std::vector<std::exception_ptr> vErrors(nThreads);
+			{
+				std::vector<std::thread> vThreads;
+				vThreads.reserve(nThreads - 1);
+				ThreadJoinGuard guard{ vThreads };
+				size_t nIdx = 1;
+				for (size_t nBegin = nTile; nBegin < nCount; nBegin += nTile, ++nIdx)
+				{
+					vThreads.emplace_back([&func, &vErrors, nIdx, nBegin, nEnd = MIN(nBegin + nTile, nCount)]()
+					{
+						try
+						{
+							func(nBegin, nEnd);
+						}
+						catch (...)
+						{
+							vErrors[nIdx] = std::current_exception();
+						}
+					});
+				}
+				func(0, MIN(nTile, nCount));
+			}
+			for (const std::exception_ptr& pError : vErrors)
+			{
+				if (pError != nullptr)
+				{
+					std::rethrow_exception(pError);
+				}
+			}
+		}
+
+		inline void StoreHSV(size_t nIdx, int nR, int nG, int nB, uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV)
+		{
+			int nH = 0;
+			int nS = 0;
+			int nV = 0;
+			RGBToHSV(nR, nG, nB, &nH, &nS, &nV);
+			pOutH[nIdx] = (uint16_t)nH;
+			pOutS[nIdx] = (uint8_t)nS;
+			pOutV[nIdx] = (uint8_t)nV;
+		}
+
+		inline void LoadRGB(const uint8_t* pR, const uint8_t* pG, const uint8_t* pB, size_t nIdx, size_t nStride, int* pOutR, int* pOutG, int* pOutB)
+		{
+			*pOutR = pR[nIdx * nStride];
+			*pOutG = pG[nIdx * nStride];
+			*pOutB = pB[nIdx * nStride];
+		}
+
+		inline bool IsValidHSV(int nH, int nS, int nV)
+		{
+			return nH <= 360 && nS <= 100 && nV <= 100;
+		}
+
+#if defined(ESK_SIMD_AVX2)
+		inline __m256d RoundPositive(__m256d vX)
+		{
+			// round()는 0.5에서 0과 먼 쪽으로 올림하므로 (x - trunc(x)) >= 0.5 로 보정 (x >= 0 전제)
+			__m256d vTrunc = _mm256_round_pd(vX, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			__m256d vUp = _mm256_cmp_pd(_mm256_sub_pd(vX, vTrunc), _mm256_set1_pd(0.5), _CMP_GE_OQ);
+			return _mm256_add_pd(vTrunc, _mm256_and_pd(vUp, _mm256_set1_pd(1.0)));
+		}
+
+		/**
+		* @brief        RGBToHSV와 같은 순서의 배정밀도 연산을 4픽셀 단위로 수행 (결과 비트 단위 동일)
+		* @details      |(G - B) / Diff| <= 1 이므로 fmod(x, 6)은 x 그대로이다.
+		*/
+		inline void RGBToHSV4(__m128i vR, __m128i vG, __m128i vB, size_t nIdx, uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV)
+		{
+			const __m256d v255 = _mm256_set1_pd(255.0);
+			const __m256d v60 = _mm256_set1_pd(60.0);
+			const __m256d v100 = _mm256_set1_pd(100.0);
+			const __m256d vZero = _mm256_setzero_pd();
+
+			__m256d vDR = _mm256_div_pd(_mm256_cvtepi32_pd(vR), v255);
+			__m256d vDG = _mm256_div_pd(_mm256_cvtepi32_pd(vG), v255);
+			__m256d vDB = _mm256_div_pd(_mm256_cvtepi32_pd(vB), v255);
+			__m256d vMax = _mm256_max_pd(_mm256_max_pd(vDR, vDG), vDB);
+			__m256d vMin = _mm256_min_pd(_mm256_min_pd(vDR, vDG), vDB);
+			__m256d vDiff = _mm256_sub_pd(vMax, vMin);
+			__m256d vHasDiff = _mm256_cmp_pd(vDiff, vZero, _CMP_GT_OQ);
+
+			__m256d vHR = _mm256_mul_pd(v60, _mm256_div_pd(_mm256_sub_pd(vDG, vDB), vDiff));
+			__m256d vHG = _mm256_mul_pd(v60, _mm256_add_pd(_mm256_div_pd(_mm256_sub_pd(vDB, vDR), vDiff), _mm256_set1_pd(2.0)));
+			__m256d vHB = _mm256_mul_pd(v60, _mm256_add_pd(_mm256_div_pd(_mm256_sub_pd(vDR, vDG), vDiff), _mm256_set1_pd(4.0)));
+			__m256d vH = _mm256_blendv_pd(vHB, vHG, _mm256_cmp_pd(vMax, vDG, _CMP_EQ_OQ));
+			vH = _mm256_blendv_pd(vH, vHR, _mm256_cmp_pd(vMax, vDR, _CMP_EQ_OQ));
+			vH = _mm256_and_pd(vH, vHasDiff);
+
+			__m256d vS = _mm256_and_pd(RoundPositive(_mm256_mul_pd(_mm256_div_pd(vDiff, vMax), v100)), vHasDiff);
+			__m256d vV = RoundPositive(_mm256_mul_pd(vMax, v100));
+
+			__m128i vIH = _mm256_cvttpd_epi32(vH);
+			vIH = _mm_add_epi32(vIH, _mm_and_si128(_mm_srai_epi32(vIH, 31), _mm_set1_epi32(360)));
+			__m128i vIS = _mm256_cvttpd_epi32(vS);
+			__m128i vIV = _mm256_cvttpd_epi32(vV);
+
+			_mm_storel_epi64((__m128i*)(pOutH + nIdx), _mm_packus_epi32(vIH, vIH));
+			__m128i vSV = _mm_packus_epi16(_mm_packus_epi32(vIS, vIV), _mm_setzero_si128());
+			int nSV = _mm_cvtsi128_si32(vSV);
+			memcpy(pOutS + nIdx, &nSV, sizeof(int));
+			nSV = _mm_extract_epi32(vSV, 1);
+			memcpy(pOutV + nIdx, &nSV, sizeof(int));
+		}
+
+		inline __m128i LoadPlanar4(const uint8_t* pSrc)
+		{
+			int nBytes = 0;
+			memcpy(&nBytes, pSrc, sizeof(int));
+			return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(nBytes));
+		}
+
+		/**
+		* @brief        HSVToRGB와 같은 순서의 배정밀도 연산을 4픽셀 단위로 수행 (결과 비트 단위 동일)
+		*/
+		inline void HSVToRGB4(__m128i vH, __m128i vS, __m128i vV, __m128i* pOutR, __m128i* pOutG, __m128i* pOutB)
+		{
+			const __m256d v100 = _mm256_set1_pd(100.0);
+			const __m256d v255 = _mm256_set1_pd(255.0);
+			const __m256d vOne = _mm256_set1_pd(1.0);
+
+			__m256d vDH = _mm256_cvtepi32_pd(vH);
+			__m256d vDS = _mm256_div_pd(_mm256_cvtepi32_pd(vS), v100);
+			__m256d vDV = _mm256_div_pd(_mm256_cvtepi32_pd(vV), v100);
+			__m256d vHH = _mm256_andnot_pd(_mm256_cmp_pd(vDH, _mm256_set1_pd(360.0), _CMP_GE_OQ), _mm256_div_pd(vDH, _mm256_set1_pd(60.0)));
+			__m256d vI = _mm256_round_pd(vHH, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			__m256d vFF = _mm256_sub_pd(vHH, vI);
+			__m256d vP = _mm256_mul_pd(vDV, _mm256_sub_pd(vOne, vDS));
+			__m256d vQ = _mm256_mul_pd(vDV, _mm256_sub_pd(vOne, _mm256_mul_pd(vDS, vFF)));
+			__m256d vT = _mm256_mul_pd(vDV, _mm256_sub_pd(vOne, _mm256_mul_pd(vDS, _mm256_sub_pd(vOne, vFF))));
+
+			__m256d vIs0 = _mm256_cmp_pd(vI, _mm256_set1_pd(0.0), _CMP_EQ_OQ);
+			__m256d vIs1 = _mm256_cmp_pd(vI, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+			__m256d vIs2 = _mm256_cmp_pd(vI, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+			__m256d vIs3 = _mm256_cmp_pd(vI, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+			__m256d vIs4 = _mm256_cmp_pd(vI, _mm256_set1_pd(4.0), _CMP_EQ_OQ);
+
+			// case 5 / default 를 기본값으로 두고 case 4 -> 0 순서로 덮어씀
+			__m256d vDR = vDV;
+			__m256d vDG = vP;
+			__m256d vDB = vQ;
+			vDR = _mm256_blendv_pd(vDR, vT, vIs4);	vDG = _mm256_blendv_pd(vDG, vP, vIs4);	vDB = _mm256_blendv_pd(vDB, vDV, vIs4);
+			vDR = _mm256_blendv_pd(vDR, vP, vIs3);	vDG = _mm256_blendv_pd(vDG, vQ, vIs3);	vDB = _mm256_blendv_pd(vDB, vDV, vIs3);
+			vDR = _mm256_blendv_pd(vDR, vP, vIs2);	vDG = _mm256_blendv_pd(vDG, vDV, vIs2);	vDB = _mm256_blendv_pd(vDB, vT, vIs2);
+			vDR = _mm256_blendv_pd(vDR, vQ, vIs1);	vDG = _mm256_blendv_pd(vDG, vDV, vIs1);	vDB = _mm256_blendv_pd(vDB, vP, vIs1);
+			vDR = _mm256_blendv_pd(vDR, vDV, vIs0);	vDG = _mm256_blendv_pd(vDG, vT, vIs0);	vDB = _mm256_blendv_pd(vDB, vP, vIs0);
+
+			// 범위를 벗어난 입력은 0
+			__m128i vValid = _mm_and_si128(_mm_cmplt_epi32(vH, _mm_set1_epi32(361)),
+				_mm_and_si128(_mm_cmplt_epi32(vS, _mm_set1_epi32(101)), _mm_cmplt_epi32(vV, _mm_set1_epi32(101))));
+			*pOutR = _mm_and_si128(_mm256_cvttpd_epi32(_mm256_mul_pd(vDR, v255)), vValid);
+			*pOutG = _mm_and_si128(_mm256_cvttpd_epi32(_mm256_mul_pd(vDG, v255)), vValid);
+			*pOutB = _mm_and_si128(_mm256_cvttpd_epi32(_mm256_mul_pd(vDB, v255)), vValid);
+		}
+
+		inline __m128i LoadHSVPlanes4(const uint16_t* pH, const uint8_t* pS, const uint8_t* pV, size_t nIdx, __m128i* pOutS, __m128i* pOutV)
+		{
+			*pOutS = LoadPlanar4(pS + nIdx);
+			*pOutV = LoadPlanar4(pV + nIdx);
+			return _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)(pH + nIdx)));
+		}
+#endif
+
+		void HSVPixelToRGB(int nH, int nS, int nV, int* pOutR, int* pOutG, int* pOutB)
+		{
+			*pOutR = 0;
+			*pOutG = 0;
+			*pOutB = 0;
+			if (IsValidHSV(nH, nS, nV))
+			{
+				HSVToRGB(nH, nS, nV, pOutR, pOutG, pOutB);
+			}
+		}
+
+		void RGBToHSVRange(const uint8_t* pR, const uint8_t* pG, const uint8_t* pB, size_t nStride,
+			size_t nBegin, size_t nEnd, uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV)
+		{
+			size_t nIdx = nBegin;
+#if defined(ESK_SIMD_AVX2)
+			if (nStride == 1)
+			{
+				for (; nIdx + 4 <= nEnd; nIdx += 4)
+				{
+					RGBToHSV4(LoadPlanar4(pR + nIdx), LoadPlanar4(pG + nIdx), LoadPlanar4(pB + nIdx), nIdx, pOutH, pOutS, pOutV);
+				}
+			}
+			else
+			{
+				for (; nIdx + 4 <= nEnd; nIdx += 4)
+				{
+					const size_t nOff = nIdx * nStride;
+					__m128i vR = _mm_setr_epi32(pR[nOff], pR[nOff + nStride], pR[nOff + 2 * nStride], pR[nOff + 3 * nStride]);
+					__m128i vG = _mm_setr_epi32(pG[nOff], pG[nOff + nStride], pG[nOff + 2 * nStride], pG[nOff + 3 * nStride]);
+					__m128i vB = _mm_setr_epi32(pB[nOff], pB[nOff + nStride], pB[nOff + 2 * nStride], pB[nOff + 3 * nStride]);
+					RGBToHSV4(vR, vG, vB, nIdx, pOutH, pOutS, pOutV);
+				}
+			}
+#endif
+			for (; nIdx < nEnd; ++nIdx)
+			{
+				int nR = 0;
+				int nG = 0;
+				int nB = 0;
+				LoadRGB(pR, pG, pB, nIdx, nStride, &nR, &nG, &nB);
+				StoreHSV(nIdx, nR, nG, nB, pOutH, pOutS, pOutV);
+			}
+		}
+
+		void HSVToRGBRange(const uint16_t* pH, const uint8_t* pS, const uint8_t* pV, size_t nBegin, size_t nEnd,
+			uint8_t* pR, uint8_t* pG, uint8_t* pB, uint8_t* pA, size_t nStride)
+		{
+			size_t nIdx = nBegin;
+#if defined(ESK_SIMD_AVX2)
+			for (; nIdx + 4 <= nEnd; nIdx += 4)
+			{
+				__m128i vS;
+				__m128i vV;
+				__m128i vH = LoadHSVPlanes4(pH, pS, pV, nIdx, &vS, &vV);
+				__m128i vR;
+				__m128i vG;
+				__m128i vB;
+				HSVToRGB4(vH, vS, vV, &vR, &vG, &vB);
+
+				alignas(16) int arrR[4];
+				alignas(16) int arrG[4];
+				alignas(16) int arrB[4];
+				_mm_store_si128((__m128i*)arrR, vR);
+				_mm_store_si128((__m128i*)arrG, vG);
+				_mm_store_si128((__m128i*)arrB, vB);
+				for (size_t i = 0; i < 4; ++i)
+				{
+					const size_t nOff = (nIdx + i) * nStride;
+					pR[nOff] = (uint8_t)arrR[i];
+					pG[nOff] = (uint8_t)arrG[i];
+					pB[nOff] = (uint8_t)arrB[i];
+					if (pA != nullptr)
+					{
+						pA[nOff] = 255;
+					}
+				}
+			}
+#endif
+			for (; nIdx < nEnd; ++nIdx)
+			{
+				int nR = 0;
+				int nG = 0;
+				int nB = 0;
+				HSVPixelToRGB(pH[nIdx], pS[nIdx], pV[nIdx], &nR, &nG, &nB);
+				const size_t nOff = nIdx * nStride;
+				pR[nOff] = (uint8_t)nR;
+				pG[nOff] = (uint8_t)nG;
+				pB[nOff] = (uint8_t)nB;
+				if (pA != nullptr)
+				{
+					pA[nOff] = 255;
+				}
+			}
+		}
+	} // namespace
+
+	EXTERN EskUtil_API bool RGBToHSVBuffer(const uint8_t* pSrc, int nChannels, size_t nPixelCount,
+		uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV, int nThreadCount)
+	{
+		if (pSrc == nullptr ||
+			pOutH == nullptr ||
+			pOutS == nullptr ||
+			pOutV == nullptr ||
+			(nChannels != 3 && nChannels != 4))
+		{
+			return false;
+		}
+
+		RunTiled(nPixelCount, nThreadCount, [=](size_t nBegin, size_t nEnd)
+		{
+			RGBToHSVRange(pSrc, pSrc + 1, pSrc + 2, (size_t)nChannels, nBegin, nEnd, pOutH, pOutS, pOutV);
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool RGBPlanarToHSVBuffer(const uint8_t* pR, const uint8_t* pG, const uint8_t* pB, size_t nPixelCount,
+		uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV, int nThreadCount)
+	{
+		if (pR == nullptr ||
+			pG == nullptr ||
+			pB == nullptr ||
+			pOutH == nullptr ||
+			pOutS == nullptr ||
+			pOutV == nullptr)
+		{
+			return false;
+		}
+
+		RunTiled(nPixelCount, nThreadCount, [=](size_t nBegin, size_t nEnd)
+		{
+			RGBToHSVRange(pR, pG, pB, 1, nBegin, nEnd, pOutH, pOutS, pOutV);
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool HexToHSVBuffer(const unsigned int* pHex, size_t nPixelCount,
+		uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV, int nThreadCount)
+	{
+		if (pHex == nullptr ||
+			pOutH == nullptr ||
+			pOutS == nullptr ||
+			pOutV == nullptr)
+		{
+			return false;
+		}
+
+		RunTiled(nPixelCount, nThreadCount, [=](size_t nBegin, size_t nEnd)
+		{
+			size_t nIdx = nBegin;
+#if defined(ESK_SIMD_AVX2)
+			const __m128i vMask = _mm_set1_epi32(0xFF);
+			for (; nIdx + 4 <= nEnd; nIdx += 4)
+			{
+				__m128i vHex = _mm_loadu_si128((const __m128i*)(pHex + nIdx));
+				RGBToHSV4(_mm_and_si128(_mm_srli_epi32(vHex, 16), vMask), _mm_and_si128(_mm_srli_epi32(vHex, 8), vMask),
+					_mm_and_si128(vHex, vMask), nIdx, pOutH, pOutS, pOutV);
+			}
+#endif
+			for (; nIdx < nEnd; ++nIdx)
+			{
+				int nR = 0;
+				int nG = 0;
+				int nB = 0;
+				HexToRGB((int)pHex[nIdx], &nR, &nG, &nB);
+				StoreHSV(nIdx, nR, nG, nB, pOutH, pOutS, pOutV);
+			}
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool HSVToRGBBuffer(const uint16_t* pH, const uint8_t* pS, const uint8_t* pV, size_t nPixelCount,
+		uint8_t* pDst, int nChannels, int nThreadCount)
+	{
+		if (pH == nullptr ||
+			pS == nullptr ||
+			pV == nullptr ||
+			pDst == nullptr ||
+			(nChannels != 3 && nChannels != 4))
+		{
+			return false;
+		}
+
+		uint8_t* pA = nChannels == 4 ? pDst + 3 : nullptr;
+		RunTiled(nPixelCount, nThreadCount, [=](size_t nBegin, size_t nEnd)
+		{
+			HSVToRGBRange(pH, pS, pV, nBegin, nEnd, pDst, pDst + 1, pDst + 2, pA, (size_t)nChannels);
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool HSVToRGBPlanarBuffer(const uint16_t* pH, const uint8_t* pS, const uint8_t* pV, size_t nPixelCount,
+		uint8_t* pOutR, uint8_t* pOutG, uint8_t* pOutB, int nThreadCount)
+	{
+		if (pH == nullptr ||
+			pS == nullptr ||
+			pV == nullptr ||
+			pOutR == nullptr ||
+			pOutG == nullptr ||
+			pOutB == nullptr)
+		{
+			return false;
+		}
+
+		RunTiled(nPixelCount, nThreadCount, [=](size_t nBegin, size_t nEnd)
+		{
+			HSVToRGBRange(pH, pS, pV, nBegin, nEnd, pOutR, pOutG, pOutB, nullptr, 1);
+		});
+		return true;
+	}
+
+	namespace
+	{
+		constexpr size_t HIST_BINS = 256;
+		constexpr size_t HIST_FLUSH_PIXELS = (size_t)1 << 31;
+
+		/**
+		* @brief        [nBegin, nEnd) 픽셀의 CHANNELS개 8비트 값을 세어 pHist(CHANNELS * 256)에 더함
+		* @details      L1에 들어가는 32비트 지역 카운터에 센 뒤 HIST_FLUSH_PIXELS마다 pHist로 옮긴다.
+		*               load(nIdx, arrValue)는 nIdx번째 픽셀의 값 CHANNELS개를 채운다.
+		*/
+		template <size_t CHANNELS, typename LOAD>
+		void AccumulateHistogram(size_t nBegin, size_t nEnd, LOAD load, uint64_t* pHist)
+		{
+			std::vector<uint32_t> vCount(CHANNELS * HIST_BINS);
+			uint32_t* pCount = vCount.data();
+			for (size_t nChunk = nBegin; nChunk < nEnd; nChunk += HIST_FLUSH_PIXELS)
+			{
+				const size_t nChunkEnd = MIN(nChunk + HIST_FLUSH_PIXELS, nEnd);
+				std::fill(vCount.begin(), vCount.end(), 0u);
+				for (size_t nIdx = nChunk; nIdx < nChunkEnd; ++nIdx)
+				{
+					uint32_t arrValue[CHANNELS];
+					load(nIdx, arrValue);
+					for (size_t c = 0; c < CHANNELS; ++c)
+					{
+						++pCount[c * HIST_BINS + arrValue[c]];
+					}
+				}
+				for (size_t i = 0; i < CHANNELS * HIST_BINS; ++i)
+				{
+					pHist[i] += pCount[i];
+				}
+			}
+		}
+
+		/**
+		* @brief        타일마다 지역 히스토그램을 채운 뒤 pOutHist에 한 번만 합침 (스레드 간 경합은 타일당 1회)
+		*/
+		template <typename FUNC>
+		void RunHistogram(size_t nPixelCount, int nThreadCount, size_t nBinCount, uint64_t* pOutHist, FUNC func)
+		{
+			std::fill(pOutHist, pOutHist + nBinCount, (uint64_t)0);
+			std::mutex mutex;
+			RunTiled(nPixelCount, nThreadCount, [&](size_t nBegin, size_t nEnd)
+			{
+				std::vector<uint64_t> vLocal(nBinCount);
+				func(nBegin, nEnd, vLocal.data());
+
+				std::lock_guard<std::mutex> lock(mutex);
+				for (size_t i = 0; i < nBinCount; ++i)
+				{
+					pOutHist[i] += vLocal[i];
+				}
+			});
+		}
+
+		template <size_t CHANNELS>
+		void AccumulateChannels(const uint8_t* pSrc, size_t nBegin, size_t nEnd, uint64_t* pHist)
+		{
+			AccumulateHistogram<CHANNELS>(nBegin, nEnd, [pSrc](size_t nIdx, uint32_t* pValue)
+			{
+				for (size_t c = 0; c < CHANNELS; ++c)
+				{
+					pValue[c] = pSrc[nIdx * CHANNELS + c];
+				}
+			}, pHist);
+		}
+
+		inline uint32_t Luminance(uint32_t nR, uint32_t nG, uint32_t nB)
+		{
+			return (77 * nR + 150 * nG + 29 * nB + 128) >> 8;
+		}
+	} // namespace
+
+	EXTERN EskUtil_API bool ChannelHistogram(const uint8_t* pSrc, int nChannels, size_t nPixelCount, uint64_t* pOutHist, int nThreadCount)
+	{
+		if (pSrc == nullptr ||
+			pOutHist == nullptr ||
+			nChannels < 1 ||
+			nChannels > 4)
+		{
+			return false;
+		}
+
+		RunHistogram(nPixelCount, nThreadCount, nChannels * HIST_BINS, pOutHist, [=](size_t nBegin, size_t nEnd, uint64_t* pHist)
+		{
+			switch (nChannels)
+			{
+				case 1:		AccumulateChannels<1>(pSrc, nBegin, nEnd, pHist);	break;
+				case 2:		AccumulateChannels<2>(pSrc, nBegin, nEnd, pHist);	break;
+				case 3:		AccumulateChannels<3>(pSrc, nBegin, nEnd, pHist);	break;
+				default:	AccumulateChannels<4>(pSrc, nBegin, nEnd, pHist);	break;
+			}
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool HexChannelHistogram(const unsigned int* pHex, size_t nPixelCount, uint64_t* pOutHist, int nThreadCount)
+	{
+		if (pHex == nullptr ||
+			pOutHist == nullptr)
+		{
+			return false;
+		}
+
+		RunHistogram(nPixelCount, nThreadCount, 3 * HIST_BINS, pOutHist, [=](size_t nBegin, size_t nEnd, uint64_t* pHist)
+		{
+			AccumulateHistogram<3>(nBegin, nEnd, [pHex](size_t nIdx, uint32_t* pValue)
+			{
+				pValue[0] = (pHex[nIdx] >> 16) & 0xFF;
+				pValue[1] = (pHex[nIdx] >> 8) & 0xFF;
+				pValue[2] = pHex[nIdx] & 0xFF;
+			}, pHist);
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool LuminanceHistogram(const uint8_t* pSrc, int nChannels, size_t nPixelCount, uint64_t* pOutHist, int nThreadCount)
+	{
+		if (pSrc == nullptr ||
+			pOutHist == nullptr ||
+			(nChannels != 3 && nChannels != 4))
+		{
+			return false;
+		}
+
+		RunHistogram(nPixelCount, nThreadCount, HIST_BINS, pOutHist, [=](size_t nBegin, size_t nEnd, uint64_t* pHist)
+		{
+			AccumulateHistogram<1>(nBegin, nEnd, [pSrc, nChannels](size_t nIdx, uint32_t* pValue)
+			{
+				const uint8_t* pPixel = pSrc + nIdx * nChannels;
+				pValue[0] = Luminance(pPixel[0], pPixel[1], pPixel[2]);
+			}, pHist);
+		});
+		return true;
+	}
+	EXTERN EskUtil_API bool HueSatHistogram(const uint8_t* pSrc, int nChannels, size_t nPixelCount,
+		int nHueBins, int nSatBins, uint64_t* pOutHist, int nThreadCount)
+	{
+		if (pSrc == nullptr ||
+			pOutHist == nullptr ||
+			(nChannels != 3 && nChannels != 4) ||
+			nHueBins < 1 ||
+			nHueBins > 360 ||
+			nSatBins < 1 ||
+			nSatBins > 101)
+		{
+			return false;
+		}
+
+		// 구간 계산의 나눗셈을 피하기 위한 값 -> 구간 테이블
+		std::vector<uint32_t> vHueBin(360);
+		std::vector<uint32_t> vSatBin(101);
+		for (int i = 0; i < 360; ++i)
+		{
+			vHueBin[i] = (uint32_t)(i * nHueBins / 360 * nSatBins);
+		}
+		for (int i = 0; i < 101; ++i)
+		{
+			vSatBin[i] = (uint32_t)(i * nSatBins / 101);
+		}
+
+		RunHistogram(nPixelCount, nThreadCount, (size_t)nHueBins * nSatBins, pOutHist, [&](size_t nBegin, size_t nEnd, uint64_t* pHist)
+		{
+			// HSV는 블록 단위로 일괄 변환한 뒤 구간을 셈 (RGBToHSVBuffer와 같은 커널 사용)
+			constexpr size_t BLOCK = 256;
+			uint16_t arrH[BLOCK];
+			uint8_t arrS[BLOCK];
+			uint8_t arrV[BLOCK];
+			for (size_t nIdx = nBegin; nIdx < nEnd; nIdx += BLOCK)
+			{
+				const size_t nCount = MIN(BLOCK, nEnd - nIdx);
+				const uint8_t* pBlock = pSrc + nIdx * nChannels;
+				RGBToHSVRange(pBlock, pBlock + 1, pBlock + 2, (size_t)nChannels, 0, nCount, arrH, arrS, arrV);
+				for (size_t i = 0; i < nCount; ++i)
+				{
+					++pHist[vHueBin[arrH[i]] + vSatBin[arrS[i]]];
+				}
+			}
+		});
+		return true;
+	}
+
+	namespace
+	{
+		constexpr size_t PIPELINE_BLOCK = 256;
+		constexpr size_t SRGB_ENCODE_SIZE = 1 << 14;
+
+		/**
+		* @brief        분기 없는 선택 (bCond ? fTrue : fFalse)
+		* @details      삼항 연산자는 한쪽에만 있는 실수 연산을 예외 가능성 때문에 분기로 남겨 두어 루프가 벡터화되지 않는다.
+		*               양쪽 값을 모두 계산한 뒤 비트 마스크로 고르면 blend 명령 하나가 된다.
+		*/
+		inline float Select(bool bCond, float fTrue, float fFalse)
+		{
+			const uint32_t nMask = 0u - (uint32_t)bCond;
+			return std::bit_cast<float>((std::bit_cast<uint32_t>(fTrue) & nMask) | (std::bit_cast<uint32_t>(fFalse) & ~nMask));
+		}
+
+		/**
+		* @brief        [0, 1]로 제한 (NaN은 0)
+		*/
+		inline float Clamp01(float fC)
+		{
+			return Select(fC > 0.0f, Select(fC < 1.0f, fC, 1.0f), 0.0f);
+		}
+
+		/**
+		* @brief        벡터화되는 floor (|fX| < 2^23 범위에서 정확, 범위 밖은 경계값으로 제한)
+		* @details      std::floor는 SSE4.1 이전 대상이나 errno 처리 때문에 함수 호출로 남는 경우가 있다.
+		*/
+		inline float Floor(float fX)
+		{
+			constexpr float LIMIT = 8388608.0f;
+			fX = Select(fX > -LIMIT, fX, -LIMIT);
+			fX = Select(fX < LIMIT, fX, LIMIT);
+			const float fT = (float)(int32_t)fX;
+			return Select(fT > fX, fT - 1.0f, fT);
+		}
+
+		/**
+		* @brief        log2 근사 (양의 정규 수, 절대 오차 1e-7 수준)
+		* @details      가수를 [sqrt(1/2), sqrt(2))로 맞춘 뒤 atanh 급수 5항으로 계산한다.
+		*/
+		inline float Log2(float fX)
+		{
+			const uint32_t nBits = std::bit_cast<uint32_t>(fX);
+			float fMant = std::bit_cast<float>((nBits & 0x007FFFFFu) | 0x3F800000u);
+			const bool bIsHigh = fMant > 1.41421356f;
+			fMant = Select(bIsHigh, fMant * 0.5f, fMant);
+			const float fExp = (float)((int32_t)(nBits >> 23) - 127 + (int32_t)bIsHigh);
+
+			const float fT = (fMant - 1.0f) / (fMant + 1.0f);
+			const float fT2 = fT * fT;
+			const float fSeries = 1.0f + fT2 * (1.0f / 3.0f + fT2 * (1.0f / 5.0f + fT2 * (1.0f / 7.0f + fT2 * (1.0f / 9.0f))));
+			return fExp + 2.88539008f * fT * fSeries;
+		}
+
+		/**
+		* @brief        2^fY 근사 (fY는 [-126, 127]로 제한, 상대 오차 2e-7 수준)
+		* @details      가장 가까운 정수 n과 나머지 f ([-0.5, 0.5])로 나누어 2^n은 지수 비트로, 2^f는 6차 Taylor 전개로 계산한다.
+		*/
+		inline float Exp2(float fY)
+		{
+			fY = Select(fY > -126.0f, fY, -126.0f);
+			fY = Select(fY < 127.0f, fY, 127.0f);
+			const float fN = Floor(fY + 0.5f);
+			const float fF = (fY - fN) * 0.693147181f;
+			const float fP = 1.0f + fF * (1.0f + fF * (1.0f / 2.0f + fF * (1.0f / 6.0f + fF * (1.0f / 24.0f + fF * (1.0f / 120.0f + fF * (1.0f / 720.0f))))));
+			return fP * std::bit_cast<float>((uint32_t)((int32_t)fN + 127) << 23);
+		}
+
+		/**
+		* @brief        양수 fX의 fY제곱 (std::pow 대신 벡터화되는 근사, 상대 오차 1e-6 이하)
+		*/
+		inline float PowPositive(float fX, float fY)
+		{
+			return Exp2(fY * Log2(fX));
+		}
+
+		inline float DecodeSRGB(float fC)
+		{
+			return Select(fC <= 0.04045f, fC * (1.0f / 12.92f), PowPositive((fC + 0.055f) * (1.0f / 1.055f), 2.4f));
+		}
+
+		inline float EncodeSRGB(float fC)
+		{
+			return Select(fC <= 0.0031308f, fC * 12.92f, 1.055f * PowPositive(fC, 1.0f / 2.4f) - 0.055f);
+		}
+
+		/**
+		* @brief        8비트 입출력 변환 테이블
+		* @details      arrEncode는 [0, 1] 선형 값을 SRGB_ENCODE_SIZE 단계로 나눈 sRGB 8비트 값 (오차 1 이하)
+		*/
+		struct PipelineTables
+		{
+			float arrNormalize[256];
+			float arrDecode[256];
+			uint8_t arrEncode[SRGB_ENCODE_SIZE];
+		};
+
+		const PipelineTables& GetPipelineTables()
+		{
+			static const PipelineTables tables = []()
+			{
+				PipelineTables newTables{};
+				for (int i = 0; i < 256; ++i)
+				{
+					newTables.arrNormalize[i] = (float)i / 255.0f;
+					newTables.arrDecode[i] = DecodeSRGB((float)i / 255.0f);
+				}
+				for (size_t i = 0; i < SRGB_ENCODE_SIZE; ++i)
+				{
+					newTables.arrEncode[i] = (uint8_t)(EncodeSRGB((float)i / (float)(SRGB_ENCODE_SIZE - 1)) * 255.0f + 0.5f);
+				}
+				return newTables;
+			}();
+			return tables;
+		}
+
+		// 각 단계는 블록 크기의 평면 배열에 대한 분기 없는 단순 루프로 작성하여 컴파일러 자동 벡터화에 맡긴다.
+		// (조건은 Select, pow/cbrt/floor는 위의 근사 함수로 대체. GCC -O3 -mavx2 -fopt-info-vec로 모든 단계의 벡터화를 확인)
+		void StageSRGBToLinear(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				pC0[i] = DecodeSRGB(pC0[i]);
+				pC1[i] = DecodeSRGB(pC1[i]);
+				pC2[i] = DecodeSRGB(pC2[i]);
+			}
+		}
+
+		void StageLinearToSRGB(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				pC0[i] = EncodeSRGB(Clamp01(pC0[i]));
+				pC1[i] = EncodeSRGB(Clamp01(pC1[i]));
+				pC2[i] = EncodeSRGB(Clamp01(pC2[i]));
+			}
+		}
+
+		// CIE Lab (D65 기준 백색점)
+		constexpr float LAB_DELTA = 6.0f / 29.0f;
+		constexpr float LAB_XN = 0.95047f;
+		constexpr float LAB_YN = 1.0f;
+		constexpr float LAB_ZN = 1.08883f;
+
+		/**
+		* @brief        양수 세제곱근 (지수 비트 초기값 + Halley 2회, 상대 오차 float 정밀도 수준)
+		* @details      std::cbrt는 벡터화되지 않는 컴파일러가 많아 Lab 변환의 대부분을 차지하므로 직접 계산한다.
+		*/
+		inline float CbrtPositive(float fX)
+		{
+			float fY = std::bit_cast<float>(std::bit_cast<uint32_t>(fX) / 3 + 0x2A5137A0u);
+			for (int i = 0; i < 2; ++i)
+			{
+				const float fY3 = fY * fY * fY;
+				fY = fY * (fY3 + 2.0f * fX) / (2.0f * fY3 + fX);
+			}
+			return fY;
+		}
+
+		inline float LabF(float fT)
+		{
+			return Select(fT > LAB_DELTA * LAB_DELTA * LAB_DELTA, CbrtPositive(fT), fT * (1.0f / (3.0f * LAB_DELTA * LAB_DELTA)) + 4.0f / 29.0f);
+		}
+
+		inline float LabFInv(float fF)
+		{
+			return Select(fF > LAB_DELTA, fF * fF * fF, 3.0f * LAB_DELTA * LAB_DELTA * (fF - 4.0f / 29.0f));
+		}
+
+		void StageLinearToLab(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fR = pC0[i];
+				const float fG = pC1[i];
+				const float fB = pC2[i];
+				const float fX = LabF((0.4124564f * fR + 0.3575761f * fG + 0.1804375f * fB) * (1.0f / LAB_XN));
+				const float fY = LabF((0.2126729f * fR + 0.7151522f * fG + 0.0721750f * fB) * (1.0f / LAB_YN));
+				const float fZ = LabF((0.0193339f * fR + 0.1191920f * fG + 0.9503041f * fB) * (1.0f / LAB_ZN));
+				pC0[i] = 116.0f * fY - 16.0f;
+				pC1[i] = 500.0f * (fX - fY);
+				pC2[i] = 200.0f * (fY - fZ);
+			}
+		}
+
+		void StageLabToLinear(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fFY = (pC0[i] + 16.0f) * (1.0f / 116.0f);
+				const float fX = LAB_XN * LabFInv(fFY + pC1[i] * (1.0f / 500.0f));
+				const float fY = LAB_YN * LabFInv(fFY);
+				const float fZ = LAB_ZN * LabFInv(fFY - pC2[i] * (1.0f / 200.0f));
+				pC0[i] = 3.2404542f * fX - 1.5371385f * fY - 0.4985314f * fZ;
+				pC1[i] = -0.9692660f * fX + 1.8760108f * fY + 0.0415560f * fZ;
+				pC2[i] = 0.0556434f * fX - 0.2040259f * fY + 1.0572252f * fZ;
+			}
+		}
+
+		/**
+		* @brief        색상 (0 ~ 360, 무채색이면 0)
+		*/
+		inline float Hue(float fR, float fG, float fB, float fMax, float fDiff)
+		{
+			const float fInvDiff = 1.0f / Select(fDiff > 0.0f, fDiff, 1.0f);
+			const float fHueR = (fG - fB) * fInvDiff;
+			const float fHueG = (fB - fR) * fInvDiff + 2.0f;
+			const float fHueB = (fR - fG) * fInvDiff + 4.0f;
+			float fH = 60.0f * Select(fMax == fR, fHueR, Select(fMax == fG, fHueG, fHueB));
+			fH = Select(fH < 0.0f, fH + 360.0f, fH);
+			return Select(fDiff > 0.0f, fH, 0.0f);
+		}
+
+		/**
+		* @brief        채도 성분(fChroma)과 색상(fH)으로 RGB를 만들고 fOffset을 더함 (HSV, HSL 공용)
+		* @details      구간별 switch 대신 채널 n (R=5, G=3, B=1)마다 k = (n + H/60) mod 6,
+		*               채널 = fOffset + fChroma * (1 - clamp(min(k, 4 - k), 0, 1))로 계산한다.
+		*/
+		inline void HueToRGB(float fH, float fChroma, float fOffset, float* pOutR, float* pOutG, float* pOutB)
+		{
+			float fHH = fH * (1.0f / 60.0f);
+			fHH -= 6.0f * Floor(fHH * (1.0f / 6.0f));
+
+			const auto channel = [fHH, fChroma, fOffset](float fN)
+			{
+				float fK = fN + fHH;
+				fK = Select(fK >= 6.0f, fK - 6.0f, fK);
+				const float fRamp = Clamp01(Select(fK < 4.0f - fK, fK, 4.0f - fK));
+				return fOffset + fChroma * (1.0f - fRamp);
+			};
+			*pOutR = channel(5.0f);
+			*pOutG = channel(3.0f);
+			*pOutB = channel(1.0f);
+		}
+
+		void StageRGBToHSV(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fMax = MAX(MAX(pC0[i], pC1[i]), pC2[i]);
+				const float fMin = MIN(MIN(pC0[i], pC1[i]), pC2[i]);
+				const float fDiff = fMax - fMin;
+				const float fS = fDiff / Select(fMax > 0.0f, fMax, 1.0f);
+				pC0[i] = Hue(pC0[i], pC1[i], pC2[i], fMax, fDiff);
+				pC1[i] = Select(fMax > 0.0f, fS, 0.0f);
+				pC2[i] = fMax;
+			}
+		}
+
+		void StageHSVToRGB(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fChroma = pC2[i] * pC1[i];
+				HueToRGB(pC0[i], fChroma, pC2[i] - fChroma, &pC0[i], &pC1[i], &pC2[i]);
+			}
+		}
+
+		void StageRGBToHSL(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fMax = MAX(MAX(pC0[i], pC1[i]), pC2[i]);
+				const float fMin = MIN(MIN(pC0[i], pC1[i]), pC2[i]);
+				const float fDiff = fMax - fMin;
+				const float fL = (fMax + fMin) * 0.5f;
+				const float fDenom = 1.0f - std::fabs(2.0f * fL - 1.0f);
+				const float fS = fDiff / Select(fDenom > 0.0f, fDenom, 1.0f);
+				pC0[i] = Hue(pC0[i], pC1[i], pC2[i], fMax, fDiff);
+				pC1[i] = Select(fDenom > 0.0f, fS, 0.0f);
+				pC2[i] = fL;
+			}
+		}
+
+		void StageHSLToRGB(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fChroma = (1.0f - std::fabs(2.0f * pC2[i] - 1.0f)) * pC1[i];
+				HueToRGB(pC0[i], fChroma, pC2[i] - fChroma * 0.5f, &pC0[i], &pC1[i], &pC2[i]);
+			}
+		}
+
+		// YUV (BT.601, 아날로그 범위)
+		void StageRGBToYUV(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fR = pC0[i];
+				const float fG = pC1[i];
+				const float fB = pC2[i];
+				pC0[i] = 0.299f * fR + 0.587f * fG + 0.114f * fB;
+				pC1[i] = -0.14713f * fR - 0.28886f * fG + 0.436f * fB;
+				pC2[i] = 0.615f * fR - 0.51499f * fG - 0.10001f * fB;
+			}
+		}
+
+		void StageYUVToRGB(float* pC0, float* pC1, float* pC2, size_t nCount)
+		{
+			for (size_t i = 0; i < nCount; ++i)
+			{
+				const float fY = pC0[i];
+				const float fU = pC1[i];
+				const float fV = pC2[i];
+				pC0[i] = fY + 1.13983f * fV;
+				pC1[i] = fY - 0.39465f * fU - 0.58060f * fV;
+				pC2[i] = fY + 2.03211f * fU;
+			}
+		}
+	} // namespace
+
+	struct ColorPipeline::Impl
+	{
+		struct Stage
+		{
+			eStage eType;
+			FilterFunc func;
+		};
+
+		std::vector<Stage> vStages;
+	};
+
+	ColorPipeline::ColorPipeline()
+		: m_pImpl(new Impl())
+	{
+	}
+	ColorPipeline::~ColorPipeline()
+	{
+		delete m_pImpl;
+	}
+	ColorPipeline::ColorPipeline(const ColorPipeline& other)
+		: m_pImpl(new Impl(*other.m_pImpl))
+	{
+	}
+	ColorPipeline::ColorPipeline(ColorPipeline&& other) noexcept
+		: m_pImpl(std::exchange(other.m_pImpl, nullptr))
+	{
+	}
+	ColorPipeline& ColorPipeline::operator=(const ColorPipeline& other)
+	{
+		if (this != &other)
+		{
+			ColorPipeline copy(other);
+			std::swap(m_pImpl, copy.m_pImpl);
+		}
+		return *this;
+	}
+	ColorPipeline& ColorPipeline::operator=(ColorPipeline&& other) noexcept
+	{
+		std::swap(m_pImpl, other.m_pImpl);
+		return *this;
+	}
+
+	ColorPipeline& ColorPipeline::SRGBToLinear()
+	{
+		return AddStage(eStage::SRGBToLinear);
+	}
+	ColorPipeline& ColorPipeline::LinearToSRGB()
+	{
+		return AddStage(eStage::LinearToSRGB);
+	}
+	ColorPipeline& ColorPipeline::LinearToLab()
+	{
+		return AddStage(eStage::LinearToLab);
+	}
+	ColorPipeline& ColorPipeline::LabToLinear()
+	{
+		return AddStage(eStage::LabToLinear);
+	}
+	ColorPipeline& ColorPipeline::RGBToHSV()
+	{
+		return AddStage(eStage::RGBToHSV);
+	}
+	ColorPipeline& ColorPipeline::HSVToRGB()
+	{
+		return AddStage(eStage::HSVToRGB);
+	}
+	ColorPipeline& ColorPipeline::RGBToHSL()
+	{
+		return AddStage(eStage::RGBToHSL);
+	}
+	ColorPipeline& ColorPipeline::HSLToRGB()
+	{
+		return AddStage(eStage::HSLToRGB);
+	}
+	ColorPipeline& ColorPipeline::RGBToYUV()
+	{
+		return AddStage(eStage::RGBToYUV);
+	}
+	ColorPipeline& ColorPipeline::YUVToRGB()
+	{
+		return AddStage(eStage::YUVToRGB);
+	}
+	ColorPipeline& ColorPipeline::Filter(FilterFunc func)
+	{
+		if (func == nullptr)
+		{
+			return *this;
+		}
+		return AddStage(eStage::Filter, std::move(func));
+	}
+	void ColorPipeline::Clear() noexcept
+	{
+		m_pImpl->vStages.clear();
+	}
+	size_t ColorPipeline::GetStageCount() const noexcept
+	{
+		return m_pImpl->vStages.size();
+	}
+	ColorPipeline& ColorPipeline::AddStage(eStage eType, FilterFunc func)
+	{
+		m_pImpl->vStages.push_back(Impl::Stage{ eType, std::move(func) });
+		return *this;
+	}
+
+	bool ColorPipeline::Run(const uint8_t* pSrc, int nSrcChannels, uint8_t* pDst, int nDstChannels, size_t nPixelCount, int nThreadCount) const
+	{
+		if (pSrc == nullptr ||
+			pDst == nullptr ||
+			(nSrcChannels != 3 && nSrcChannels != 4) ||
+			(nDstChannels != 3 && nDstChannels != 4) ||
+			(pSrc == pDst && nSrcChannels != nDstChannels))
+		{
+			return false;
+		}
+
+		RunTiled(nPixelCount, nThreadCount, [=, this](size_t nBegin, size_t nEnd)
+		{
+			for (size_t nIdx = nBegin; nIdx < nEnd; nIdx += PIPELINE_BLOCK)
+			{
+				RunBlock(pSrc + nIdx * nSrcChannels, nSrcChannels, pDst + nIdx * nDstChannels, nDstChannels,
+					MIN(PIPELINE_BLOCK, nEnd - nIdx));
+			}
+		});
+		return true;
+	}
+
+	void ColorPipeline::RunBlock(const uint8_t* pSrc, int nSrcChannels, uint8_t* pDst, int nDstChannels, size_t nCount) const
+	{
+		alignas(32) float arrC0[PIPELINE_BLOCK];
+		alignas(32) float arrC1[PIPELINE_BLOCK];
+		alignas(32) float arrC2[PIPELINE_BLOCK];
+		alignas(32) uint8_t arrAlpha[PIPELINE_BLOCK];
+		const PipelineTables& tables = GetPipelineTables();
+
+		// 처음/마지막 sRGB 변환은 8비트 입출력 테이블로 대체
+		size_t nFirst = 0;
+		const std::vector<Impl::Stage>& vStages = m_pImpl->vStages;
+		size_t nLast = vStages.size();
+		const bool bDecode = nLast > 0 && vStages.front().eType == eStage::SRGBToLinear;
+		if (bDecode)
+		{
+			++nFirst;
+		}
+		const bool bEncode = nLast > nFirst && vStages.back().eType == eStage::LinearToSRGB;
+		if (bEncode)
+		{
+			--nLast;
+		}
+
+		const float* pLoadTable = bDecode ? tables.arrDecode : tables.arrNormalize;
+		for (size_t i = 0; i < nCount; ++i)
+		{
+			const uint8_t* pPixel = pSrc + i * nSrcChannels;
+			arrC0[i] = pLoadTable[pPixel[0]];
+			arrC1[i] = pLoadTable[pPixel[1]];
+			arrC2[i] = pLoadTable[pPixel[2]];
+			arrAlpha[i] = nSrcChannels == 4 ? pPixel[3] : 255;
+		}
+
+		for (size_t nStage = nFirst; nStage < nLast; ++nStage)
+		{
+			const Impl::Stage& stage = vStages[nStage];
+			switch (stage.eType)
+			{
+				case eStage::SRGBToLinear:	StageSRGBToLinear(arrC0, arrC1, arrC2, nCount);	break;
+				case eStage::LinearToSRGB:	StageLinearToSRGB(arrC0, arrC1, arrC2, nCount);	break;
+				case eStage::LinearToLab:	StageLinearToLab(arrC0, arrC1, arrC2, nCount);	break;
+				case eStage::LabToLinear:	StageLabToLinear(arrC0, arrC1, arrC2, nCount);	break;
+				case eStage::RGBToHSV:		StageRGBToHSV(arrC0, arrC1, arrC2, nCount);		break;
+				case eStage::HSVToRGB:		StageHSVToRGB(arrC0, arrC1, arrC2, nCount);		break;
+				case eStage::RGBToHSL:		StageRGBToHSL(arrC0, arrC1, arrC2, nCount);		break;
+				case eStage::HSLToRGB:		StageHSLToRGB(arrC0, arrC1, arrC2, nCount);		break;
+				case eStage::RGBToYUV:		StageRGBToYUV(arrC0, arrC1, arrC2, nCount);		break;
+				case eStage::YUVToRGB:		StageYUVToRGB(arrC0, arrC1, arrC2, nCount);		break;
+				case eStage::Filter:		stage.func(arrC0, arrC1, arrC2, nCount);			break;
+				default:					break;
+			}
+		}
+
+		for (size_t i = 0; i < nCount; ++i)
+		{
+			uint8_t* pPixel = pDst + i * nDstChannels;
+			if (bEncode)
+			{
+				const float fScale = (float)(SRGB_ENCODE_SIZE - 1);
+				pPixel[0] = tables.arrEncode[(size_t)(Clamp01(arrC0[i]) * fScale + 0.5f)];
+				pPixel[1] = tables.arrEncode[(size_t)(Clamp01(arrC1[i]) * fScale + 0.5f)];
+				pPixel[2] = tables.arrEncode[(size_t)(Clamp01(arrC2[i]) * fScale + 0.5f)];
+			}
+			else
+			{
+				pPixel[0] = (uint8_t)(Clamp01(arrC0[i]) * 255.0f + 0.5f);
+				pPixel[1] = (uint8_t)(Clamp01(arrC1[i]) * 255.0f + 0.5f);
+				pPixel[2] = (uint8_t)(Clamp01(arrC2[i]) * 255.0f + 0.5f);
+			}
+			if (nDstChannels == 4)
+			{
+				pPixel[3] = arrAlpha[i];
+			}
+		}
+	}
 } // namespace esk::util_conv
\ No newline at end of file
@@ -1,13 +1,15 @@
 ﻿/**
 * @file			Convert.h
 * @author		yc.jeon (Eskeptor)
-* @date			2026-04-21
-* @version		0.0.3
+* @date			2026-10-18
+* @version		0.0.4
 * @brief		Convert Utility
 */
 
 #pragma once
 #include "Common.h"
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace esk::gearforge::util::conv
@@ -22,4 +24,158 @@ namespace esk::gearforge::util::conv
 	EXTERN EskUtil_API void HexToHSV(int nHex, int* nOutH, int* nOutS, int* nOutV);
 	EXTERN EskUtil_API void HSVToRGB(int nH, int nS, int nV, int* nOutR, int* nOutG, int* nOutB);
 	EXTERN EskUtil_API unsigned int HSVToHex(int nH, int nS, int nV);
+
+	/**
+	* @brief        RGB 이미지 버퍼를 HSV 평면 버퍼로 일괄 변환하는 함수 (결과는 RGBToHSV와 동일)
+	* @param[in]    pSrc            RGB 또는 RGBA 순서로 저장된 픽셀 버퍼
+	* @param[in]    nChannels       픽셀당 바이트 수 (3: RGB, 4: RGBA)
+	* @param[in]    nPixelCount     픽셀 개수
+	* @param[out]   pOutH           H 평면 (0 ~ 359)
+	* @param[out]   pOutS           S 평면 (0 ~ 100)
+	* @param[out]   pOutV           V 평면 (0 ~ 100)
+	* @param[in]    nThreadCount    사용할 스레드 수 (0: 코어 수, 1: 호출 스레드만 사용)
+	* @return       true: 성공, false: 인자 오류
+	*/
+	EXTERN EskUtil_API bool RGBToHSVBuffer(const uint8_t* pSrc, int nChannels, size_t nPixelCount,
+		uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV, int nThreadCount = 1);
+	/**
+	* @brief        R/G/B 평면 버퍼를 HSV 평면 버퍼로 일괄 변환하는 함수 (결과는 RGBToHSV와 동일)
+	*/
+	EXTERN EskUtil_API bool RGBPlanarToHSVBuffer(const uint8_t* pR, const uint8_t* pG, const uint8_t* pB, size_t nPixelCount,
+		uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV, int nThreadCount = 1);
+	/**
+	* @brief        0xRRGGBB 형식의 색상 배열을 HSV 평면 버퍼로 일괄 변환하는 함수 (결과는 HexToHSV와 동일)
+	*/
+	EXTERN EskUtil_API bool HexToHSVBuffer(const unsigned int* pHex, size_t nPixelCount,
+		uint16_t* pOutH, uint8_t* pOutS, uint8_t* pOutV, int nThreadCount = 1);
+	/**
+	* @brief        HSV 평면 버퍼를 RGB 이미지 버퍼로 일괄 변환하는 함수 (결과는 HSVToRGB와 동일)
+	* @param[in]    pH              H 평면 (0 ~ 360)
+	* @param[in]    pS              S 평면 (0 ~ 100)
+	* @param[in]    pV              V 평면 (0 ~ 100)
+	* @param[in]    nPixelCount     픽셀 개수
+	* @param[out]   pDst            RGB 또는 RGBA 순서로 저장할 픽셀 버퍼 (범위를 벗어난 HSV는 0, 알파는 255)
+	* @param[in]    nChannels       픽셀당 바이트 수 (3: RGB, 4: RGBA)
+	* @param[in]    nThreadCount    사용할 스레드 수 (0: 코어 수, 1: 호출 스레드만 사용)
+	* @return       true: 성공, false: 인자 오류
+	*/
+	EXTERN EskUtil_API bool HSVToRGBBuffer(const uint16_t* pH, const uint8_t* pS, const uint8_t* pV, size_t nPixelCount,
+		uint8_t* pDst, int nChannels, int nThreadCount = 1);
+	/**
+	* @brief        HSV 평면 버퍼를 R/G/B 평면 버퍼로 일괄 변환하는 함수 (결과는 HSVToRGB와 동일)
+	*/
+	EXTERN EskUtil_API bool HSVToRGBPlanarBuffer(const uint16_t* pH, const uint8_t* pS, const uint8_t* pV, size_t nPixelCount,
+		uint8_t* pOutR, uint8_t* pOutG, uint8_t* pOutB, int nThreadCount = 1);
+
+	/**
+	* @brief        채널별 히스토그램을 구하는 함수
+	* @param[in]    pSrc            픽셀 버퍼 (채널이 연속으로 저장된 형식)
+	* @param[in]    nChannels       픽셀당 바이트 수 (1 ~ 4)
+	* @param[in]    nPixelCount     픽셀 개수
+	* @param[out]   pOutHist        채널별 256개 구간 (nChannels * 256개, 채널 c의 값 v는 pOutHist[c * 256 + v])
+	* @param[in]    nThreadCount    사용할 스레드 수 (0: 코어 수, 1: 호출 스레드만 사용)
+	* @return       true: 성공, false: 인자 오류
+	*/
+	EXTERN EskUtil_API bool ChannelHistogram(const uint8_t* pSrc, int nChannels, size_t nPixelCount, uint64_t* pOutHist, int nThreadCount = 1);
+	/**
+	* @brief        0xRRGGBB 형식의 색상 배열에서 R, G, B 히스토그램을 구하는 함수 (pOutHist는 3 * 256개)
+	*/
+	EXTERN EskUtil_API bool HexChannelHistogram(const unsigned int* pHex, size_t nPixelCount, uint64_t* pOutHist, int nThreadCount = 1);
+	/**
+	* @brief        휘도(BT.601, Y = (77R + 150G + 29B + 128) >> 8) 히스토그램을 구하는 함수 (pOutHist는 256개)
+	* @param[in]    nChannels       픽셀당 바이트 수 (3: RGB, 4: RGBA)
+	*/
+	EXTERN EskUtil_API bool LuminanceHistogram(const uint8_t* pSrc, int nChannels, size_t nPixelCount, uint64_t* pOutHist, int nThreadCount = 1);
+	/**
+	* @brief        H-S 2차원 히스토그램을 구하는 함수 (HSV 값은 RGBToHSV와 동일)
+	* @param[in]    nChannels       픽셀당 바이트 수 (3: RGB, 4: RGBA)
+	* @param[in]    nHueBins        H 구간 수 (1 ~ 360, H 0 ~ 359를 균등 분할)
+	* @param[in]    nSatBins        S 구간 수 (1 ~ 101, S 0 ~ 100을 균등 분할)
+	* @param[out]   pOutHist        nHueBins * nSatBins개 (H 구간 h, S 구간 s는 pOutHist[h * nSatBins + s])
+	*/
+	EXTERN EskUtil_API bool HueSatHistogram(const uint8_t* pSrc, int nChannels, size_t nPixelCount,
+		int nHueBins, int nSatBins, uint64_t* pOutHist, int nThreadCount = 1);
+
+	/**
+	* @brief        여러 색 공간 변환을 하나로 묶어 한 번에 수행하는 파이프라인
+	* @details      단계를 등록해 두고 Run()을 호출하면 작은 픽셀 블록 단위로 모든 단계를 연속 적용한다.
+	*               중간 결과는 블록 크기의 float 평면(C0, C1, C2)에만 보관되므로 이미지 크기의 중간 버퍼가 생기지 않는다.
+	*               입력 8비트 RGB는 [0, 1]로 정규화되어 들어오고, 마지막 단계의 결과는 [0, 1]로 clamp 후 8비트로 저장된다.
+	*               각 단계의 채널 의미:
+	*               - sRGB / Linear RGB : R, G, B (0 ~ 1)
+	*               - HSV / HSL         : H (0 ~ 360), S (0 ~ 1), V 또는 L (0 ~ 1)
+	*               - YUV (BT.601)      : Y (0 ~ 1), U (-0.436 ~ 0.436), V (-0.615 ~ 0.615)
+	*               - Lab (D65)         : L (0 ~ 100), a, b
+	*               첫 단계가 SRGBToLinear이면 입력 시 테이블 변환으로, 마지막 단계가 LinearToSRGB이면 출력 시 테이블 변환으로 합쳐진다.
+	*               예) ColorPipeline().SRGBToLinear().LinearToLab().Filter(func).LabToLinear().LinearToSRGB().Run(...)
+	*/
+	class EskUtil_API ColorPipeline
+	{
+	public:
+		/**
+		* @brief        Filter 단계 함수 (세 평면을 제자리에서 수정, nCount는 블록 픽셀 수)
+		* @details      Run의 nThreadCount가 1이 아니면 여러 스레드에서 서로 다른 블록으로 동시에 호출되므로,
+		*               함수 객체가 가진 상태를 고친다면 직접 동기화해야 한다. (NaN/무한대 결과는 출력 시 0 또는 255로 제한됨)
+		*               함수가 던진 예외는 모든 스레드가 끝난 뒤 Run을 호출한 스레드로 전달된다.
+		*/
+		using FilterFunc = std::function<void(float* pC0, float* pC1, float* pC2, size_t nCount)>;
+
+		ColorPipeline();
+		~ColorPipeline();
+		ColorPipeline(const ColorPipeline& other);
+		ColorPipeline(ColorPipeline&& other) noexcept;		///< 이동된 객체는 대입 또는 소멸만 가능
+		ColorPipeline& operator=(const ColorPipeline& other);
+		ColorPipeline& operator=(ColorPipeline&& other) noexcept;
+
+		ColorPipeline& SRGBToLinear();
+		ColorPipeline& LinearToSRGB();
+		ColorPipeline& LinearToLab();
+		ColorPipeline& LabToLinear();
+		ColorPipeline& RGBToHSV();
+		ColorPipeline& HSVToRGB();
+		ColorPipeline& RGBToHSL();
+		ColorPipeline& HSLToRGB();
+		ColorPipeline& RGBToYUV();
+		ColorPipeline& YUVToRGB();
+		ColorPipeline& Filter(FilterFunc func);
+
+		void Clear() noexcept;
+		size_t GetStageCount() const noexcept;
+
+		/**
+		* @brief        등록된 단계를 픽셀 버퍼에 적용하는 함수
+		* @param[in]    pSrc            RGB 또는 RGBA 순서의 입력 버퍼
+		* @param[in]    nSrcChannels    입력 픽셀당 바이트 수 (3 또는 4)
+		* @param[out]   pDst            RGB 또는 RGBA 순서의 출력 버퍼 (채널 수가 같으면 pSrc와 같아도 됨, 알파는 입력에 있으면 유지하고 없으면 255)
+		* @param[in]    nDstChannels    출력 픽셀당 바이트 수 (3 또는 4)
+		* @param[in]    nPixelCount     픽셀 개수
+		* @param[in]    nThreadCount    사용할 스레드 수 (0: 코어 수, 1: 호출 스레드만 사용)
+		* @return       true: 성공, false: 인자 오류
+		*/
+		bool Run(const uint8_t* pSrc, int nSrcChannels, uint8_t* pDst, int nDstChannels, size_t nPixelCount, int nThreadCount = 1) const;
+
+	private:
+		enum class eStage
+		{
+			SRGBToLinear = 0,
+			LinearToSRGB,
+			LinearToLab,
+			LabToLinear,
+			RGBToHSV,
+			HSVToRGB,
+			RGBToHSL,
+			HSLToRGB,
+			RGBToYUV,
+			YUVToRGB,
+			Filter,
+		};
+
+		// 단계 목록(std::vector, std::function)은 DLL 경계에 노출하지 않도록 Convert.cpp에만 정의 (C4251)
+		struct Impl;
+
+		ColorPipeline& AddStage(eStage eType, FilterFunc func = nullptr);
+		void RunBlock(const uint8_t* pSrc, int nSrcChannels, uint8_t* pDst, int nDstChannels, size_t nCount) const;
+
+		Impl* m_pImpl;
+	};
 } // namespace esk::util_conv
\ No newline at end of file
@@ -1,8 +1,8 @@
 ﻿/**
  * @file	    File.cpp
  * @author	    yc.jeon (Eskeptor)
- * @date        2026.04.21
- * @version     0.0.3
+ * @date        2026.10.18
+ * @version     0.0.4
  */
 
 #include <sstream>
@@ -10,6 +10,7 @@
 #pragma comment(lib, "version.lib")
 
 #include "File.h"
+#include "String.h"
 
 namespace esk::gearforge::engine::util::file
 {
@@ -199,7 +200,8 @@ namespace esk::gearforge::engine::util::file
             return "";
         }
 
-        std::string strResult = "";
+        // 버전 문자열은 64바이트 이내이므로 스택 버퍼에서 조립
+        esk::gearforge::util::str::StackStringBuilder<64> builder;
         DWORD dwVersionHandle = 0;
         DWORD dwVerSize = ::GetFileVersionInfoSizeA(pszFilePath, &dwVersionHandle);
         if (dwVerSize != 0)
@@ -215,7 +217,7 @@ namespace esk::gearforge::engine::util::file
                 if (pVerInfo->dwSignature == 0xFEEF04BD)
                 {
                     // 파일 버전
-                    strResult = std::format("{}.{}.{}.{}",
+                    builder.Format("{}.{}.{}.{}",
                         (pVerInfo->dwFileVersionMS >> 16) & 0xFFFF,
                         (pVerInfo->dwFileVersionMS) & 0xFFFF,
                         (pVerInfo->dwFileVersionLS >> 16) & 0xFFFF,
@@ -227,7 +229,7 @@ namespace esk::gearforge::engine::util::file
         }
         else
         {
-            strResult = "1.0.0.0";
+            builder.Append("1.0.0.0");
         }
 
         // 파일 수정 시간 추가 (선택 사항)
@@ -240,10 +242,10 @@ namespace esk::gearforge::engine::util::file
             ::FileTimeToSystemTime(&fileTime, &stUTC);
             ::SystemTimeToTzSpecificLocalTime(NULL, &stUTC, &stLocal);
 
-            strResult = std::format("{}({}.{:02}.{:02} {:02}:{:02}:{:02})",
-                strResult, stLocal.wYear, stLocal.wMonth, stLocal.wDay, stLocal.wHour, stLocal.wMinute, stLocal.wSecond);
+            builder.Format("({}.{:02}.{:02} {:02}:{:02}:{:02})",
+                stLocal.wYear, stLocal.wMonth, stLocal.wDay, stLocal.wHour, stLocal.wMinute, stLocal.wSecond);
         }
 
-        return strResult;
+        return builder.ToString();
     }
 }
\ No newline at end of file
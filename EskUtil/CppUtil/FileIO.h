@@ -0,0 +1,30 @@
+﻿/**
+* @file			FileIO.h
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		String / INI Utility가 함께 쓰는 C 파일 입출력 도우미
+*/
+
+#pragma once
+#include <cstdio>
+
+namespace esk::gearforge::util::detail
+{
+    /**
+    * @brief        파일을 여는 함수 (MSVC에서는 fopen_s 사용, 실패 시 nullptr)
+    */
+    inline FILE* OpenFile(const char* pszFileName, const char* pszMode) noexcept
+    {
+        FILE* pFile = nullptr;
+#if defined(_MSC_VER)
+        if (::fopen_s(&pFile, pszFileName, pszMode) != 0)
+        {
+            pFile = nullptr;
+        }
+#else
+        pFile = ::fopen(pszFileName, pszMode);
+#endif
+        return pFile;
+    }
+} // namespace esk::util_detail
\ No newline at end of file
@@ -1,128 +1,1852 @@
 ﻿/**
 * @file			Ini.h
 * @author		yc.jeon (Eskeptor)
-* @date			2026-04-21
-* @version		0.0.3
+* @date			2026-10-18
+* @version		0.0.4
 * @brief		INI Utility
 */
 
 #pragma once
 #include "Common.h"
+#include "FileIO.h"
 
-#include <stdio.h>
-#include <Windows.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#if defined(_WIN32)
+    #include <io.h>
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
 
 namespace esk::gearforge::util::ini
 {
+    namespace detail
+    {
+        using util::detail::OpenFile;
+
+        /**
+        * @brief        파일 전체를 읽는 함수
+        * @return       true: 성공, false: 열기/읽기 실패
+        */
+        inline bool ReadFile(const char* pszFileName, std::vector<char>* pOutBuffer)
+        {
+            if (pszFileName == nullptr ||
+                pOutBuffer == nullptr)
+            {
+                return false;
+            }
+
+            FILE* pFile = OpenFile(pszFileName, "rb");
+            if (pFile == nullptr)
+            {
+                return false;
+            }
+
+            const size_t READ_SIZE = 64 * 1024;
+            pOutBuffer->clear();
+            size_t nRead = 0;
+            do
+            {
+                const size_t nOldSize = pOutBuffer->size();
+                pOutBuffer->resize(nOldSize + READ_SIZE);
+                nRead = ::fread(pOutBuffer->data() + nOldSize, 1, READ_SIZE, pFile);
+                pOutBuffer->resize(nOldSize + nRead);
+            } while (nRead == READ_SIZE);
+
+            const bool bIsError = ::ferror(pFile) != 0;
+            ::fclose(pFile);
+            return !bIsError;
+        }
+
+        /**
+        * @brief        [pCur, pEnd)에서 ch가 처음 나오는 위치 (없으면 pEnd)
+        */
+        inline const char* FindByte(const char* pCur, const char* pEnd, char ch) noexcept
+        {
+            // CRT의 memchr은 SIMD로 구현되어 있음
+            const void* pFound = ::memchr(pCur, ch, static_cast<size_t>(pEnd - pCur));
+            return pFound != nullptr ? static_cast<const char*>(pFound) : pEnd;
+        }
+
+        /**
+        * @brief        [pCur, pEnd)에서 ch1 또는 ch2가 처음 나오는 위치 (없으면 pEnd)
+        */
+        inline const char* FindEither(const char* pCur, const char* pEnd, char ch1, char ch2) noexcept
+        {
+#if defined(ESK_SIMD_AVX2)
+            const __m256i v1 = _mm256_set1_epi8(ch1);
+            const __m256i v2 = _mm256_set1_epi8(ch2);
+            for (; pEnd - pCur >= 32; pCur += 32)
+            {
+                const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pCur));
+                const uint32_t nMask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(vData, v1), _mm256_cmpeq_epi8(vData, v2))));
+                if (nMask != 0)
+                {
+                    return pCur + std::countr_zero(nMask);
+                }
+            }
+#elif defined(ESK_SIMD_NEON)
+            const uint8x16_t v1 = vdupq_n_u8(static_cast<uint8_t>(ch1));
+            const uint8x16_t v2 = vdupq_n_u8(static_cast<uint8_t>(ch2));
+            for (; pEnd - pCur >= 16; pCur += 16)
+            {
+                const uint8x16_t vData = vld1q_u8(reinterpret_cast<const uint8_t*>(pCur));
+                const uint8x16_t vEqual = vorrq_u8(vceqq_u8(vData, v1), vceqq_u8(vData, v2));
+                // 바이트당 4비트 마스크로 줄여 64비트 하나로 검사
+                const uint64_t nMask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vEqual), 4)), 0);
+                if (nMask != 0)
+                {
+                    return pCur + (std::countr_zero(nMask) >> 2);
+                }
+            }
+#endif
+            for (; pCur < pEnd; ++pCur)
+            {
+                if (*pCur == ch1 ||
+                    *pCur == ch2)
+                {
+                    return pCur;
+                }
+            }
+            return pEnd;
+        }
+
+        inline bool IsEqualNoCase(std::string_view svLeft, std::string_view svRight) noexcept
+        {
+            if (svLeft.size() != svRight.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < svLeft.size(); ++i)
+            {
+                char chLeft = svLeft[i];
+                if (chLeft >= 'A' && chLeft <= 'Z')
+                {
+                    chLeft = static_cast<char>(chLeft - 'A' + 'a');
+                }
+                if (chLeft != svRight[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+        * @brief        정수 해석 (10진수, "0x"로 시작하면 16진수, 실패하면 nDefault)
+        */
+        inline int64_t ParseInt(std::string_view svValue, int64_t nDefault) noexcept
+        {
+            if (svValue.empty())
+            {
+                return nDefault;
+            }
+
+            bool bIsNegative = false;
+            if (svValue.front() == '-' || svValue.front() == '+')
+            {
+                bIsNegative = svValue.front() == '-';
+                svValue.remove_prefix(1);
+            }
+
+            int nBase = 10;
+            if (svValue.size() > 2 &&
+                svValue[0] == '0' &&
+                (svValue[1] == 'x' || svValue[1] == 'X'))
+            {
+                nBase = 16;
+                svValue.remove_prefix(2);
+            }
+
+            uint64_t nValue = 0;
+            const char* pEnd = svValue.data() + svValue.size();
+            std::from_chars_result result = std::from_chars(svValue.data(), pEnd, nValue, nBase);
+            if (result.ec != std::errc() ||
+                result.ptr != pEnd ||
+                nValue > static_cast<uint64_t>(INT64_MAX) + (bIsNegative ? 1 : 0))
+            {
+                return nDefault;
+            }
+            return bIsNegative ? static_cast<int64_t>(0 - nValue) : static_cast<int64_t>(nValue);
+        }
+
+        /**
+        * @brief        실수 해석 (실패하면 dDefault)
+        */
+        inline double ParseDouble(std::string_view svValue, double dDefault) noexcept
+        {
+            if (!svValue.empty() && svValue.front() == '+')
+            {
+                svValue.remove_prefix(1);
+            }
+
+            double dValue = 0.0;
+            const char* pEnd = svValue.data() + svValue.size();
+            std::from_chars_result result = std::from_chars(svValue.data(), pEnd, dValue);
+            if (svValue.empty() ||
+                result.ec != std::errc() ||
+                result.ptr != pEnd)
+            {
+                return dDefault;
+            }
+            return dValue;
+        }
+
+        /**
+        * @brief        bool 해석 (1/true/yes/on, 0/false/no/off, 대소문자 무시, 실패하면 bDefault)
+        */
+        inline bool ParseBool(std::string_view svValue, bool bDefault) noexcept
+        {
+            for (std::string_view svTrue : { "1", "true", "yes", "on" })
+            {
+                if (IsEqualNoCase(svValue, svTrue))
+                {
+                    return true;
+                }
+            }
+            for (std::string_view svFalse : { "0", "false", "no", "off" })
+            {
+                if (IsEqualNoCase(svValue, svFalse))
+                {
+                    return false;
+                }
+            }
+            return bDefault;
+        }
+
+        /**
+        * @brief        쓰기 버퍼를 비우고 내용을 디스크까지 내리는 함수
+        */
+        inline bool SyncFile(FILE* pFile) noexcept
+        {
+            if (::fflush(pFile) != 0)
+            {
+                return false;
+            }
+#if defined(_WIN32)
+            return ::_commit(::_fileno(pFile)) == 0;
+#else
+            return ::fsync(::fileno(pFile)) == 0;
+#endif
+        }
+
+        /**
+        * @brief        같은 파일을 쓰는 다른 스레드/프로세스와 겹치지 않는 임시 파일 이름 (<파일>.<pid>.<순번>.tmp)
+        */
+        inline std::string MakeTempFileName(const char* pszFileName)
+        {
+            static std::atomic<uint32_t> s_nSequence{ 0 };
+#if defined(_WIN32)
+            const int nProcessId = ::_getpid();
+#else
+            const int nProcessId = static_cast<int>(::getpid());
+#endif
+            return std::string(pszFileName) + '.' + std::to_string(nProcessId) + '.' +
+                std::to_string(s_nSequence.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+        }
+
+        /**
+        * @brief        임시 파일에 전부 쓰고 디스크에 내린 뒤 rename으로 교체 (실패하면 원본은 그대로)
+        */
+        inline bool WriteFileAtomic(const char* pszFileName, std::string_view svText)
+        {
+            const std::string strTemp = MakeTempFileName(pszFileName);
+            FILE* pFile = OpenFile(strTemp.c_str(), "wb");
+            if (pFile == nullptr)
+            {
+                return false;
+            }
+
+            bool bIsSuccess = ::fwrite(svText.data(), 1, svText.size(), pFile) == svText.size();
+            bIsSuccess = SyncFile(pFile) && bIsSuccess;
+            bIsSuccess = ::fclose(pFile) == 0 && bIsSuccess;
+
+            std::error_code errCode;
+            if (bIsSuccess)
+            {
+                std::filesystem::rename(strTemp, pszFileName, errCode);
+            }
+            if (!bIsSuccess || errCode)
+            {
+                std::filesystem::remove(strTemp, errCode);
+                return false;
+            }
+            return true;
+        }
+    } // namespace detail
+
+    /**
+    * @brief        INI 파일을 한 번 읽어 섹션/키 색인을 만들어 두는 문서 클래스
+    * @details      파일 전체를 하나의 버퍼로 읽은 뒤 복사 없이 토큰화하며, 섹션/키/값은 모두 버퍼를 가리키는 string_view로 보관한다.
+    *               조회는 섹션 -> 키 2단계 해시 색인으로 수행한다. (대소문자 구분, 같은 키가 여러 번 있으면 처음 것 사용)
+    *               - 빈 줄과 ';', '#'으로 시작하는 줄은 무시
+    *               - 첫 섹션 이전의 키는 이름이 빈 섹션("")에 속함
+    *               - 키와 값의 앞뒤 공백은 제거, 따옴표로 감싼 값은 따옴표 안쪽만 사용
+    *               - 파일 앞의 UTF-8 BOM은 무시, 줄 길이 제한 없음
+    *               string_view가 내부 버퍼를 가리키므로 복사는 막고 이동만 허용한다. (이동해도 버퍼 주소는 유지)
+    */
+    class IniDocument
+    {
+    public:
+        /**
+        * @brief        파일 순서대로 보관되는 항목
+        */
+        struct Entry
+        {
+            std::string_view svSection;
+            std::string_view svKey;
+            std::string_view svValue;
+        };
+
+        IniDocument() = default;
+        IniDocument(const IniDocument&) = delete;
+        IniDocument& operator=(const IniDocument&) = delete;
+        IniDocument(IniDocument&&) noexcept = default;
+        IniDocument& operator=(IniDocument&&) noexcept = default;
+
+        /**
+        * @brief        INI 파일을 읽어 색인을 만드는 함수 (기존 내용은 지워짐)
+        * @param[in]    pszFileName     INI 파일의 경로
+        * @return       true: 성공, false: 파일 열기/읽기 실패
+        */
+        bool LoadFile(const char* pszFileName)
+        {
+            if (pszFileName == nullptr)
+            {
+                return false;
+            }
+
+            std::vector<char> vBuffer;
+            if (!detail::ReadFile(pszFileName, &vBuffer))
+            {
+                return false;
+            }
+
+            Parse(std::move(vBuffer));
+            return true;
+        }
+
+        /**
+        * @brief        메모리의 INI 텍스트로 색인을 만드는 함수 (텍스트는 내부 버퍼로 복사됨)
+        * @param[in]    svText          INI 텍스트
+        */
+        void LoadText(std::string_view svText)
+        {
+            Parse(std::vector<char>(svText.begin(), svText.end()));
+        }
+
+        /**
+        * @brief        이미 읽어 둔 버퍼로 색인을 만드는 함수 (버퍼의 소유권을 넘겨받음)
+        */
+        void LoadBuffer(std::vector<char>&& vBuffer)
+        {
+            Parse(std::move(vBuffer));
+        }
+
+        void Clear() noexcept
+        {
+            m_vBuffer.clear();
+            m_vEntries.clear();
+            m_mapSections.clear();
+            m_mapHeaders.clear();
+            m_nKeyCount = 0;
+        }
+
+        bool HasSection(std::string_view svSection) const
+        {
+            return m_mapSections.find(svSection) != m_mapSections.end();
+        }
+
+        bool HasKey(std::string_view svSection, std::string_view svKey) const
+        {
+            return FindEntry(svSection, svKey) != nullptr;
+        }
+
+        /**
+        * @brief        문자열 값을 받아오는 함수
+        * @param[in]    svSection       섹션 이름
+        * @param[in]    svKey           키 이름
+        * @param[in]    svDefault       값이 없을 때 반환할 기본값
+        * @return       값 (문서가 살아있는 동안 유효)
+        */
+        std::string_view GetString(std::string_view svSection, std::string_view svKey, std::string_view svDefault = {}) const
+        {
+            const Entry* pEntry = FindEntry(svSection, svKey);
+            return pEntry != nullptr ? pEntry->svValue : svDefault;
+        }
+
+        /**
+        * @brief        정수 값을 받아오는 함수 (10진수, "0x"로 시작하면 16진수)
+        * @return       값 (없거나 정수가 아니면 nDefault)
+        */
+        int64_t GetInt(std::string_view svSection, std::string_view svKey, int64_t nDefault = 0) const
+        {
+            return detail::ParseInt(GetString(svSection, svKey), nDefault);
+        }
+
+        /**
+        * @return       값 (없거나 실수가 아니면 dDefault)
+        */
+        double GetDouble(std::string_view svSection, std::string_view svKey, double dDefault = 0.0) const
+        {
+            return detail::ParseDouble(GetString(svSection, svKey), dDefault);
+        }
+
+        /**
+        * @brief        bool 값을 받아오는 함수 (1/true/yes/on, 0/false/no/off, 대소문자 무시)
+        * @return       값 (없거나 해석할 수 없으면 bDefault)
+        */
+        bool GetBool(std::string_view svSection, std::string_view svKey, bool bDefault = false) const
+        {
+            return detail::ParseBool(GetString(svSection, svKey), bDefault);
+        }
+
+        size_t GetSectionCount() const noexcept
+        {
+            return m_mapSections.size();
+        }
+
+        /**
+        * @brief        파일 순서대로의 전체 항목 (중복 키 포함)
+        */
+        const std::vector<Entry>& GetEntries() const noexcept
+        {
+            return m_vEntries;
+        }
+
+        /**
+        * @brief        중복을 제외한 키 수
+        */
+        size_t GetKeyCount() const noexcept
+        {
+            return m_nKeyCount;
+        }
+
+        /**
+        * @brief        항목을 찾는 함수 (같은 키가 여러 번 있으면 처음 것, 없으면 nullptr)
+        */
+        const Entry* FindEntry(std::string_view svSection, std::string_view svKey) const
+        {
+            auto iterSection = m_mapSections.find(svSection);
+            if (iterSection == m_mapSections.end())
+            {
+                return nullptr;
+            }
+
+            auto iterKey = iterSection->second.find(svKey);
+            if (iterKey == iterSection->second.end())
+            {
+                return nullptr;
+            }
+            return &m_vEntries[iterKey->second];
+        }
+
+        /**
+        * @brief        섹션 머리 줄 ("[이름]"이 있는 줄, 같은 섹션이 여러 번 있으면 처음 것, 없으면 빈 값)
+        */
+        std::string_view GetSectionHeader(std::string_view svSection) const
+        {
+            auto iter = m_mapHeaders.find(svSection);
+            return iter != m_mapHeaders.end() ? iter->second : std::string_view();
+        }
+
+        /**
+        * @brief        읽어 들인 원문 전체 (항목의 string_view는 이 안을 가리킴)
+        */
+        std::string_view GetText() const noexcept
+        {
+            return std::string_view(m_vBuffer.data(), m_vBuffer.size());
+        }
+
+    private:
+        using KeyIndex = std::unordered_map<std::string_view, size_t>;
+
+        static bool IsSpace(char ch) noexcept
+        {
+            return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f';
+        }
+
+        static std::string_view Trim(std::string_view svText) noexcept
+        {
+            while (!svText.empty() && IsSpace(svText.front()))
+            {
+                svText.remove_prefix(1);
+            }
+            while (!svText.empty() && IsSpace(svText.back()))
+            {
+                svText.remove_suffix(1);
+            }
+            return svText;
+        }
+
+        /**
+        * @brief        줄 끝('\n') 다음 위치 (줄바꿈 없이 끝난 마지막 줄이면 pEnd)
+        */
+        static const char* SkipLine(const char* pLineEnd, const char* pEnd) noexcept
+        {
+            return pLineEnd < pEnd ? pLineEnd + 1 : pEnd;
+        }
+
+        /**
+        * @brief        값의 앞뒤 공백을 제거하고, 따옴표(" 또는 ')로 감싸져 있으면 따옴표 안쪽만 남김
+        * @details      따옴표 안의 공백, ';', '#', '='은 그대로 유지되며, 닫는 따옴표 뒤의 내용은 무시한다. (이스케이프는 처리하지 않음)
+        */
+        static std::string_view ParseValue(std::string_view svValue) noexcept
+        {
+            svValue = Trim(svValue);
+            if (!svValue.empty() &&
+                (svValue.front() == '"' || svValue.front() == '\''))
+            {
+                const size_t nClose = svValue.find(svValue.front(), 1);
+                if (nClose != std::string_view::npos)
+                {
+                    return svValue.substr(1, nClose - 1);
+                }
+            }
+            return svValue;
+        }
+
+        void Parse(std::vector<char>&& vBuffer)
+        {
+            Clear();
+            m_vBuffer = std::move(vBuffer);
+
+            const char* pCur = m_vBuffer.data();
+            const char* pEnd = pCur + m_vBuffer.size();
+            if (m_vBuffer.size() >= 3 &&
+                static_cast<uint8_t>(pCur[0]) == 0xEF &&
+                static_cast<uint8_t>(pCur[1]) == 0xBB &&
+                static_cast<uint8_t>(pCur[2]) == 0xBF)
+            {
+                pCur += 3;
+            }
+
+            std::string_view svSection;
+            KeyIndex* pKeys = &m_mapSections[svSection];
+            while (pCur < pEnd)
+            {
+                while (pCur < pEnd && IsSpace(*pCur))
+                {
+                    ++pCur;
+                }
+                if (pCur >= pEnd)
+                {
+                    break;
+                }
+
+                // 줄의 첫 글자로 종류를 정하고, 키 줄은 '='과 줄바꿈을 한 번의 SIMD 탐색으로 찾음
+                const char chFirst = *pCur;
+                if (chFirst == '\n')
+                {
+                    ++pCur;
+                    continue;
+                }
+                if (chFirst == ';' ||
+                    chFirst == '#')
+                {
+                    pCur = SkipLine(detail::FindByte(pCur, pEnd, '\n'), pEnd);
+                    continue;
+                }
+                if (chFirst == '[')
+                {
+                    const char* pLineEnd = detail::FindByte(pCur, pEnd, '\n');
+                    std::string_view svLine(pCur, pLineEnd - pCur);
+                    const size_t nClose = svLine.find(']');
+                    if (nClose != std::string_view::npos)
+                    {
+                        svSection = Trim(svLine.substr(1, nClose - 1));
+                        pKeys = &m_mapSections[svSection];
+                        m_mapHeaders.emplace(svSection, svLine);
+                    }
+                    pCur = SkipLine(pLineEnd, pEnd);
+                    continue;
+                }
+
+                const char* pEqual = detail::FindEither(pCur, pEnd, '=', '\n');
+                if (pEqual == pEnd ||
+                    *pEqual == '\n')
+                {
+                    pCur = SkipLine(pEqual, pEnd);
+                    continue;
+                }
+
+                const char* pLineEnd = detail::FindByte(pEqual + 1, pEnd, '\n');
+                Entry entry{ svSection, Trim(std::string_view(pCur, pEqual - pCur)), ParseValue(std::string_view(pEqual + 1, pLineEnd - pEqual - 1)) };
+                // 조회는 처음 나온 항목을 따르고, 중복 항목은 편집기가 지울 수 있도록 목록에만 남김
+                if (pKeys->emplace(entry.svKey, m_vEntries.size()).second)
+                {
+                    ++m_nKeyCount;
+                }
+                m_vEntries.push_back(entry);
+                pCur = SkipLine(pLineEnd, pEnd);
+            }
+
+            // 키가 없는 전역 섹션은 색인에서 제외
+            auto iterGlobal = m_mapSections.find(std::string_view());
+            if (iterGlobal != m_mapSections.end() &&
+                iterGlobal->second.empty())
+            {
+                m_mapSections.erase(iterGlobal);
+            }
+        }
+
+        std::vector<char> m_vBuffer;
+        std::vector<Entry> m_vEntries;
+        std::unordered_map<std::string_view, KeyIndex> m_mapSections;
+        std::unordered_map<std::string_view, std::string_view> m_mapHeaders;
+        size_t m_nKeyCount = 0;
+    };
+
+    /**
+    * @brief        원문의 형식과 주석을 유지하면서 INI 값을 고치는 편집기
+    * @details      SetValue/RemoveKey는 변경을 모아 두기만 하고, Apply/Commit 때 원문에서 바뀐 부분만 교체한 새 텍스트를 만든다.
+    *               - 기존 키: 처음 나온 항목의 값 부분만 교체 (따옴표로 감싼 값은 따옴표 유지, 조회도 처음 항목을 따름)
+    *               - 새 키: 해당 섹션의 마지막 항목 다음 줄에 삽입, 섹션이 없으면 파일 끝에 섹션을 추가
+    *               - 삭제: 항목이 있는 줄 전체 제거 (같은 키가 여러 번 있으면 모두)
+    *               같은 키를 여러 번 고치면 마지막 것만 반영된다. 줄바꿈은 원문에 "\r\n"이 있으면 "\r\n"을 사용한다.
+    *               Commit은 임시 파일에 전부 쓴 뒤 rename으로 교체하므로, 중간에 실패해도 원본은 이전 내용 그대로 남는다.
+    */
+    class IniEditor
+    {
+    public:
+        IniEditor() = default;
+
+        /**
+        * @brief        INI 파일을 읽는 함수 (모아 둔 변경은 버려짐)
+        * @return       true: 성공, false: 읽기 실패
+        */
+        bool LoadFile(const char* pszFileName)
+        {
+            m_vEdits.clear();
+            m_mapEditIndex.clear();
+            if (!m_doc.LoadFile(pszFileName))
+            {
+                m_strFileName.clear();
+                return false;
+            }
+            m_strFileName = pszFileName;
+            return true;
+        }
+
+        void LoadText(std::string_view svText)
+        {
+            m_vEdits.clear();
+            m_mapEditIndex.clear();
+            m_strFileName.clear();
+            m_doc.LoadText(svText);
+        }
+
+        /**
+        * @brief        마지막으로 반영된 문서 (모아 둔 변경은 포함되지 않음)
+        */
+        const IniDocument& GetDocument() const noexcept
+        {
+            return m_doc;
+        }
+
+        /**
+        * @brief        값 변경/추가를 예약하는 함수
+        * @return       true: 예약됨, false: 다시 읽었을 때 같은 값이 될 수 없는 이름/값
+        *               (줄바꿈 포함, 빈 키, 키에 '=' 포함, 키가 ';' '#' '['로 시작, 섹션에 ']' 포함, 이름 앞뒤 공백,
+        *               따옴표로 감싸야 하는 값에 두 종류의 따옴표가 모두 있음 - 파서가 이스케이프를 지원하지 않음)
+        */
+        bool SetValue(std::string_view svSection, std::string_view svKey, std::string_view svValue)
+        {
+            if (!IsValidName(svSection, svKey) ||
+                svValue.find_first_of("\r\n") != std::string_view::npos ||
+                (NeedsQuote(svValue) && HasBothQuotes(svValue)))
+            {
+                return false;
+            }
+            AddEdit(svSection, svKey, false, svValue);
+            return true;
+        }
+
+        /**
+        * @brief        키 삭제를 예약하는 함수
+        */
+        bool RemoveKey(std::string_view svSection, std::string_view svKey)
+        {
+            if (!IsValidName(svSection, svKey))
+            {
+                return false;
+            }
+            AddEdit(svSection, svKey, true, std::string_view());
+            return true;
+        }
+
+        bool HasPendingEdits() const noexcept
+        {
+            return !m_vEdits.empty();
+        }
+
+        void DiscardEdits() noexcept
+        {
+            m_vEdits.clear();
+            m_mapEditIndex.clear();
+        }
+
+        /**
+        * @brief        예약된 변경을 반영한 텍스트를 만드는 함수 (문서는 바뀌지 않음)
+        */
+        std::string BuildText() const
+        {
+            const std::string_view svText = m_doc.GetText();
+            const char* pBase = svText.data();
+            const std::string_view svNewLine = svText.find("\r\n") != std::string_view::npos ? "\r\n" : "\n";
+
+            const bool bHasRemove = std::any_of(m_vEdits.begin(), m_vEdits.end(), [](const Edit& edit) { return edit.bIsRemove; });
+
+            // 섹션별 새 키를 넣을 위치 (마지막 항목 줄의 다음), 삭제할 키는 중복된 줄까지 모두 제거
+            std::unordered_map<std::string_view, size_t> mapInsertPos;
+            std::vector<Patch> vPatches;
+            std::string strId;
+            for (const IniDocument::Entry& entry : m_doc.GetEntries())
+            {
+                const size_t nLineEnd = NextLine(svText, static_cast<size_t>(entry.svValue.data() - pBase) + entry.svValue.size());
+                mapInsertPos[entry.svSection] = nLineEnd;
+                if (!bHasRemove)
+                {
+                    continue;
+                }
+
+                strId.assign(entry.svSection);
+                strId += '\0';
+                strId += entry.svKey;
+                auto iterEdit = m_mapEditIndex.find(strId);
+                if (iterEdit != m_mapEditIndex.end() &&
+                    m_vEdits[iterEdit->second].bIsRemove)
+                {
+                    const size_t nKey = static_cast<size_t>(entry.svKey.data() - pBase);
+                    const size_t nLineStart = nKey == 0 ? std::string_view::npos : svText.rfind('\n', nKey - 1);
+                    const size_t nStart = nLineStart != std::string_view::npos ? nLineStart + 1 : (HasBOM(svText) ? 3 : 0);
+                    vPatches.push_back(Patch{ nStart, nLineEnd - nStart, 0, std::string() });
+                }
+            }
+
+            std::vector<std::string> vNewSections;
+            std::unordered_map<std::string, std::string> mapNewSectionLines;
+            for (const Edit& edit : m_vEdits)
+            {
+                if (edit.bIsRemove)
+                {
+                    continue;
+                }
+
+                const IniDocument::Entry* pEntry = m_doc.FindEntry(edit.strSection, edit.strKey);
+                if (pEntry != nullptr)
+                {
+                    size_t nOffset = static_cast<size_t>(pEntry->svValue.data() - pBase);
+                    size_t nLength = pEntry->svValue.size();
+                    std::string strText;
+                    const bool bIsQuoted = nOffset > 0 &&
+                        nOffset + nLength < svText.size() &&
+                        IsQuote(svText[nOffset - 1]) &&
+                        svText[nOffset + nLength] == svText[nOffset - 1];
+                    if (nLength == 0 &&
+                        !bIsQuoted)
+                    {
+                        nOffset = GetEmptyValueOffset(svText, static_cast<size_t>(pEntry->svKey.data() - pBase) + pEntry->svKey.size());
+                    }
+                    if (bIsQuoted)
+                    {
+                        // 두 종류의 따옴표가 모두 있으면 감쌀 수 없으므로 따옴표를 없앰 (SetValue가 따옴표 없이 표현 가능한 값만 받음)
+                        strText = HasBothQuotes(edit.strValue) ? edit.strValue : Quote(edit.strValue, svText[nOffset - 1]);
+                        --nOffset;
+                        nLength += 2;
+                    }
+                    else
+                    {
+                        strText = FormatValue(edit.strValue);
+                    }
+                    vPatches.push_back(Patch{ nOffset, nLength, 0, std::move(strText) });
+                    continue;
+                }
+
+                std::string strLine = edit.strKey + "=" + FormatValue(edit.strValue);
+                strLine += svNewLine;
+
+                size_t nPos = std::string_view::npos;
+                auto iterPos = mapInsertPos.find(edit.strSection);
+                if (iterPos != mapInsertPos.end())
+                {
+                    nPos = iterPos->second;
+                }
+                else if (!m_doc.GetSectionHeader(edit.strSection).empty())
+                {
+                    const std::string_view svHeader = m_doc.GetSectionHeader(edit.strSection);
+                    nPos = NextLine(svText, static_cast<size_t>(svHeader.data() - pBase) + svHeader.size());
+                }
+                else if (edit.strSection.empty())
+                {
+                    nPos = HasBOM(svText) ? 3 : 0;
+                }
+
+                if (nPos == std::string_view::npos)
+                {
+                    auto iterNew = mapNewSectionLines.find(edit.strSection);
+                    if (iterNew == mapNewSectionLines.end())
+                    {
+                        vNewSections.push_back(edit.strSection);
+                        iterNew = mapNewSectionLines.emplace(edit.strSection, std::string()).first;
+                    }
+                    iterNew->second += strLine;
+                    continue;
+                }
+
+                if (nPos == svText.size() &&
+                    !svText.empty() &&
+                    svText.back() != '\n')
+                {
+                    strLine.insert(0, svNewLine);
+                }
+                vPatches.push_back(Patch{ nPos, 0, 1, std::move(strLine) });
+            }
+
+            // 같은 위치에서는 교체/삭제를 삽입보다 먼저 적용
+            std::stable_sort(vPatches.begin(), vPatches.end(), [](const Patch& left, const Patch& right)
+            {
+                return left.nOffset != right.nOffset ? left.nOffset < right.nOffset : left.nOrder < right.nOrder;
+            });
+
+            std::string strResult;
+            strResult.reserve(svText.size() + 64 * (vPatches.size() + vNewSections.size()));
+            size_t nCopied = 0;
+            for (const Patch& patch : vPatches)
+            {
+                strResult.append(svText.substr(nCopied, patch.nOffset - nCopied));
+                strResult.append(patch.strText);
+                nCopied = patch.nOffset + patch.nLength;
+            }
+            strResult.append(svText.substr(nCopied));
+
+            for (const std::string& strSection : vNewSections)
+            {
+                if (!strResult.empty())
+                {
+                    if (strResult.back() != '\n')
+                    {
+                        strResult += svNewLine;
+                    }
+                    strResult += svNewLine;
+                }
+                strResult += "[" + strSection + "]";
+                strResult += svNewLine;
+                strResult += mapNewSectionLines[strSection];
+            }
+            return strResult;
+        }
+
+        /**
+        * @brief        예약된 변경을 메모리의 문서에만 반영하는 함수
+        */
+        void Apply()
+        {
+            if (m_vEdits.empty())
+            {
+                return;
+            }
+            m_doc.LoadText(BuildText());
+            DiscardEdits();
+        }
+
+        /**
+        * @brief        예약된 변경을 반영하여 읽었던 파일에 한 번에 쓰는 함수
+        * @return       true: 성공, false: 파일로 읽지 않았거나 쓰기 실패 (실패 시 예약된 변경은 유지)
+        */
+        bool Commit()
+        {
+            if (m_strFileName.empty())
+            {
+                return false;
+            }
+            return CommitTo(m_strFileName.c_str());
+        }
+
+        /**
+        * @brief        예약된 변경을 반영하여 지정한 파일에 한 번에 쓰는 함수 (임시 파일 작성 후 rename)
+        */
+        bool CommitTo(const char* pszFileName)
+        {
+            if (pszFileName == nullptr)
+            {
+                return false;
+            }
+
+            std::string strText = BuildText();
+            if (!detail::WriteFileAtomic(pszFileName, strText))
+            {
+                return false;
+            }
+            m_doc.LoadText(strText);
+            m_strFileName = pszFileName;
+            DiscardEdits();
+            return true;
+        }
+
+    private:
+        struct Edit
+        {
+            std::string strSection;
+            std::string strKey;
+            bool bIsRemove;
+            std::string strValue;
+        };
+
+        struct Patch
+        {
+            size_t nOffset;
+            size_t nLength;
+            int nOrder;
+            std::string strText;
+        };
+
+        void AddEdit(std::string_view svSection, std::string_view svKey, bool bIsRemove, std::string_view svValue)
+        {
+            std::string strId(svSection);
+            strId += '\0';
+            strId += svKey;
+            auto iter = m_mapEditIndex.find(strId);
+            if (iter != m_mapEditIndex.end())
+            {
+                m_vEdits[iter->second].bIsRemove = bIsRemove;
+                m_vEdits[iter->second].strValue = svValue;
+                return;
+            }
+            m_mapEditIndex.emplace(std::move(strId), m_vEdits.size());
+            m_vEdits.push_back(Edit{ std::string(svSection), std::string(svKey), bIsRemove, std::string(svValue) });
+        }
+
+        /**
+        * @brief        파서가 같은 이름으로 다시 읽을 수 있는지 검사 (이름은 앞뒤 공백이 지워지고, 줄 첫 글자 ';' '#'은 주석, '['는 섹션)
+        */
+        static bool IsValidName(std::string_view svSection, std::string_view svKey) noexcept
+        {
+            return !svKey.empty() &&
+                svKey.find_first_of("=\r\n") == std::string_view::npos &&
+                svKey.front() != ';' && svKey.front() != '#' && svKey.front() != '[' &&
+                !IsBlank(svKey.front()) && !IsBlank(svKey.back()) &&
+                svSection.find_first_of("]\r\n") == std::string_view::npos &&
+                (svSection.empty() || (!IsBlank(svSection.front()) && !IsBlank(svSection.back())));
+        }
+
+        /**
+        * @brief        파서의 Trim이 지우는 공백 (줄바꿈 제외)
+        */
+        static bool IsBlank(char ch) noexcept
+        {
+            return ch == ' ' || ch == '\t' || ch == '\v' || ch == '\f';
+        }
+
+        static bool IsQuote(char ch) noexcept
+        {
+            return ch == '"' || ch == '\'';
+        }
+
+        static bool HasBothQuotes(std::string_view svValue) noexcept
+        {
+            return svValue.find('"') != std::string_view::npos &&
+                svValue.find('\'') != std::string_view::npos;
+        }
+
+        /**
+        * @brief        따옴표 없이 쓰면 다시 읽었을 때 값이 달라지는지 여부 (앞뒤 공백, 따옴표로 시작)
+        */
+        static bool NeedsQuote(std::string_view svValue) noexcept
+        {
+            return !svValue.empty() &&
+                (IsQuote(svValue.front()) || IsBlank(svValue.front()) || IsBlank(svValue.back()));
+        }
+
+        static bool HasBOM(std::string_view svText) noexcept
+        {
+            return svText.size() >= 3 &&
+                static_cast<uint8_t>(svText[0]) == 0xEF &&
+                static_cast<uint8_t>(svText[1]) == 0xBB &&
+                static_cast<uint8_t>(svText[2]) == 0xBF;
+        }
+
+        /**
+        * @brief        nPos가 속한 줄의 다음 줄 시작 위치 (마지막 줄이면 텍스트 끝)
+        */
+        static size_t NextLine(std::string_view svText, size_t nPos) noexcept
+        {
+            const size_t nLineEnd = svText.find('\n', nPos);
+            return nLineEnd == std::string_view::npos ? svText.size() : nLineEnd + 1;
+        }
+
+        /**
+        * @brief        빈 값을 넣을 위치 ('=' 뒤 공백/탭 다음, 줄 끝의 '\r'보다 앞)
+        * @details      빈 값의 string_view는 Trim이 '\r'까지 지운 뒤의 위치를 가리키므로 원문에서 다시 찾는다.
+        * @param[in]    nKeyEnd         키 끝 위치 (키에는 '='이 없으므로 그 뒤 첫 '='이 구분자)
+        */
+        static size_t GetEmptyValueOffset(std::string_view svText, size_t nKeyEnd) noexcept
+        {
+            size_t nPos = svText.find('=', nKeyEnd);
+            if (nPos == std::string_view::npos)
+            {
+                return nKeyEnd;
+            }
+            ++nPos;
+            while (nPos < svText.size() &&
+                (svText[nPos] == ' ' || svText[nPos] == '\t'))
+            {
+                ++nPos;
+            }
+            return nPos;
+        }
+
+        static std::string Quote(const std::string& strValue, char chQuote)
+        {
+            if (strValue.find(chQuote) != std::string::npos)
+            {
+                chQuote = chQuote == '"' ? '\'' : '"';
+            }
+            return chQuote + strValue + chQuote;
+        }
+
+        /**
+        * @brief        다시 읽었을 때 같은 값이 되도록 필요하면 따옴표로 감쌈
+        */
+        static std::string FormatValue(const std::string& strValue)
+        {
+            if (NeedsQuote(strValue))
+            {
+                return Quote(strValue, '"');
+            }
+            return strValue;
+        }
+
+        IniDocument m_doc;
+        std::string m_strFileName;
+        std::vector<Edit> m_vEdits;
+        std::unordered_map<std::string, size_t> m_mapEditIndex;
+    };
+
     /**
-    * @brief        INI 파일에서 데이터를 받아오는 함수
-    * @param[in]    szSection       INI 파일에서 읽어올 데이터의 섹션 이름
-    * @param[in]    szKey           INI 파일에서 읽어올 데이터 키의 이름
-    * @param[in]    szDefault       INI 파일에서 해당 값이 없을 때 반환해줄 기본값
-    * @param[out]   szOutBuffer     INI 파일에서 읽어온 데이터
-    * @param[in]    nBufferSize     읽어올 데이터 버퍼의 최대 길이
-    * @param[in]    szFileName      INI 파일의 경로 (전체 경로)
-    * @return       읽어온 데이터의 길이 (읽어오지 못했다면 0)
+    * @brief        INI 파일을 미리 컴파일한 바이너리 캐시로 읽는 클래스
+    * @details      캐시 이미지는 헤더, 버킷별 변위 배열, 슬롯 배열, 항목 배열, 문자열 풀로 구성되며 모든 위치는 이미지 시작 기준 오프셋이다.
+    *               따라서 파일을 그대로 메모리에 올리거나 매핑하면 해석 없이 바로 조회할 수 있다. (네이티브 바이트 순서)
+    *               키 색인은 hash-and-displace 방식의 완전 해시로, 조회 한 번에 해시 1회와 문자열 비교 1회만 수행한다.
+    *               Open은 원본의 크기/수정 시각이 캐시에 기록된 값과 같으면 캐시를 사용하고,
+    *               다르면 원본 내용의 해시를 비교한다. 해시까지 다르면 원본을 IniDocument로 읽고 (bIsAutoCompile이면) 캐시를 다시 만든다.
     */
-    int GetIniString(const char* szSection,
-        const char* szKey,
-        const char* szDefault,
-        char* szOutBuffer,
-        const int& nBufferSize,
-        const char* szFileName)
+    class IniCache
     {
-        const int MAX_LENGTH = 512;
-        const char CHAR_LF = 0xA;
+    public:
+        IniCache() = default;
+        IniCache(const IniCache&) = delete;
+        IniCache& operator=(const IniCache&) = delete;
+        IniCache(IniCache&&) noexcept = default;
+        IniCache& operator=(IniCache&&) noexcept = default;
+
+        /**
+        * @brief        INI 파일을 캐시를 통해 여는 함수
+        * @param[in]    pszIniFile      원본 INI 파일의 경로
+        * @param[in]    pszCacheFile    캐시 파일의 경로 (nullptr이면 "<원본>.cache")
+        * @param[in]    bIsAutoCompile  캐시가 없거나 오래되었을 때 다시 만들지 여부
+        * @return       true: 성공 (캐시 또는 원본), false: 둘 다 읽지 못함
+        */
+        bool Open(const char* pszIniFile, const char* pszCacheFile = nullptr, bool bIsAutoCompile = true)
+        {
+            Close();
+            if (pszIniFile == nullptr)
+            {
+                return false;
+            }
+
+            const std::string strCacheFile = pszCacheFile != nullptr ? std::string(pszCacheFile) : std::string(pszIniFile) + ".cache";
+            SourceInfo source;
+            const bool bHasSource = GetSourceInfo(pszIniFile, &source);
+
+            std::vector<char> vImage;
+            const bool bHasImage = detail::ReadFile(strCacheFile.c_str(), &vImage) && IsValidImage(vImage);
+            CacheHeader header{};
+            if (bHasImage)
+            {
+                ::memcpy(&header, vImage.data(), sizeof(CacheHeader));
+                // 원본이 없으면 검증할 수 없으므로 캐시를 그대로 사용
+                if (!bHasSource ||
+                    (header.nSourceSize == source.nSize && header.nSourceTime == source.nTime))
+                {
+                    UseImage(std::move(vImage));
+                    return true;
+                }
+            }
+            if (!bHasSource)
+            {
+                return false;
+            }
+
+            std::vector<char> vSource;
+            if (!detail::ReadFile(pszIniFile, &vSource))
+            {
+                return false;
+            }
+            source.nHash = HashBytes(vSource.data(), vSource.size());
+
+            // 수정 시각만 바뀐 경우 (내용 동일)
+            if (bHasImage &&
+                header.nSourceSize == vSource.size() &&
+                header.nSourceHash == source.nHash)
+            {
+                if (bIsAutoCompile && IsSourceUnchanged(pszIniFile, source))
+                {
+                    header.nSourceTime = source.nTime;
+                    ::memcpy(vImage.data(), &header, sizeof(CacheHeader));
+                    detail::WriteFileAtomic(strCacheFile.c_str(), std::string_view(vImage.data(), vImage.size()));
+                }
+                UseImage(std::move(vImage));
+                return true;
+            }
 
-        char szBuffer[MAX_LENGTH] = { 0, };
-        char* pEqual = nullptr;
-        char szFormattedSection[MAX_LENGTH] = { 0, };
-        int nFormattedSectionLength = 0;
-        int nKeyLength = static_cast<int>(::strlen(szKey));
-        char* pCh = nullptr;
+            m_doc.LoadBuffer(std::move(vSource));
+            if (bIsAutoCompile && IsSourceUnchanged(pszIniFile, source))
+            {
+                const std::string strImage = BuildImage(m_doc, source);
+                if (!strImage.empty())
+                {
+                    detail::WriteFileAtomic(strCacheFile.c_str(), strImage);
+                }
+            }
+            return true;
+        }
 
-        FILE* pFile = nullptr;
-        errno_t nErrCode = ::fopen_s(&pFile, szFileName, "r");
-        if (nErrCode != 0)
+        /**
+        * @brief        INI 파일을 캐시 파일로 컴파일하는 함수
+        * @return       true: 성공, false: 원본 읽기 또는 캐시 쓰기 실패
+        */
+        static bool Compile(const char* pszIniFile, const char* pszCacheFile)
         {
-            return 0;
+            SourceInfo source;
+            std::vector<char> vSource;
+            if (pszCacheFile == nullptr ||
+                !GetSourceInfo(pszIniFile, &source) ||
+                !detail::ReadFile(pszIniFile, &vSource))
+            {
+                return false;
+            }
+            source.nHash = HashBytes(vSource.data(), vSource.size());
+
+            IniDocument doc;
+            doc.LoadBuffer(std::move(vSource));
+            const std::string strImage = BuildImage(doc, source);
+            return !strImage.empty() && detail::WriteFileAtomic(pszCacheFile, strImage);
+        }
+
+        void Close() noexcept
+        {
+            m_vImage.clear();
+            m_header = CacheHeader{};
+            m_bIsFromCache = false;
+            m_doc.Clear();
+        }
+
+        /**
+        * @brief        마지막 Open이 캐시를 사용했는지 여부 (false면 원본을 파싱함)
+        */
+        bool IsFromCache() const noexcept
+        {
+            return m_bIsFromCache;
+        }
+
+        bool HasKey(std::string_view svSection, std::string_view svKey) const
+        {
+            if (!m_bIsFromCache)
+            {
+                return m_doc.HasKey(svSection, svKey);
+            }
+            return FindImageEntry(svSection, svKey) != EMPTY_SLOT;
+        }
+
+        std::string_view GetString(std::string_view svSection, std::string_view svKey, std::string_view svDefault = {}) const
+        {
+            if (!m_bIsFromCache)
+            {
+                return m_doc.GetString(svSection, svKey, svDefault);
+            }
+
+            const uint32_t nIndex = FindImageEntry(svSection, svKey);
+            if (nIndex == EMPTY_SLOT)
+            {
+                return svDefault;
+            }
+            const CacheEntry entry = ReadEntry(nIndex);
+            return GetPoolString(entry.nValue, entry.nValueLength);
+        }
+
+        int64_t GetInt(std::string_view svSection, std::string_view svKey, int64_t nDefault = 0) const
+        {
+            return detail::ParseInt(GetString(svSection, svKey), nDefault);
+        }
+
+        double GetDouble(std::string_view svSection, std::string_view svKey, double dDefault = 0.0) const
+        {
+            return detail::ParseDouble(GetString(svSection, svKey), dDefault);
+        }
+
+        bool GetBool(std::string_view svSection, std::string_view svKey, bool bDefault = false) const
+        {
+            return detail::ParseBool(GetString(svSection, svKey), bDefault);
+        }
+
+        size_t GetCount() const noexcept
+        {
+            return m_bIsFromCache ? static_cast<size_t>(m_header.nEntryCount) : m_doc.GetKeyCount();
+        }
+
+    private:
+        static constexpr char CACHE_MAGIC[8] = { 'E', 'S', 'K', 'I', 'N', 'I', 'C', 'C' };
+        static constexpr uint64_t CACHE_VERSION = 1;
+        static constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+        static constexpr uint32_t MAX_DISPLACEMENT = 1u << 20;
+
+        struct CacheHeader
+        {
+            char arrMagic[8];
+            uint64_t nVersion;
+            uint64_t nSourceSize;
+            int64_t nSourceTime;
+            uint64_t nSourceHash;
+            uint64_t nEntryCount;
+            uint64_t nBucketCount;
+            uint64_t nSlotCount;
+            uint64_t nBucketOffset;     // uint32_t 변위 x nBucketCount
+            uint64_t nSlotOffset;       // uint32_t 항목 번호 x nSlotCount
+            uint64_t nEntryOffset;      // CacheEntry x nEntryCount
+            uint64_t nStringOffset;
+            uint64_t nStringSize;
+            uint64_t nImageSize;
+            uint64_t nBodyHash;         // 헤더 뒤 전체의 해시
+        };
+
+        struct CacheEntry
+        {
+            uint32_t nSection;
+            uint32_t nSectionLength;
+            uint32_t nKey;
+            uint32_t nKeyLength;
+            uint32_t nValue;
+            uint32_t nValueLength;
+        };
+
+        struct SourceInfo
+        {
+            uint64_t nSize = 0;
+            int64_t nTime = 0;
+            uint64_t nHash = 0;
+        };
+
+        static bool GetSourceInfo(const char* pszIniFile, SourceInfo* pOutInfo)
+        {
+            std::error_code errCode;
+            const uintmax_t nSize = std::filesystem::file_size(pszIniFile, errCode);
+            if (errCode)
+            {
+                return false;
+            }
+            const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(pszIniFile, errCode);
+            if (errCode)
+            {
+                return false;
+            }
+            pOutInfo->nSize = static_cast<uint64_t>(nSize);
+            pOutInfo->nTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+            return true;
+        }
+
+        /**
+        * @brief        읽는 동안 원본이 바뀌지 않았는지 확인 (바뀌었으면 잘못된 시각이 기록되지 않도록 캐시를 쓰지 않음)
+        */
+        static bool IsSourceUnchanged(const char* pszIniFile, const SourceInfo& source)
+        {
+            SourceInfo current;
+            return GetSourceInfo(pszIniFile, &current) &&
+                current.nSize == source.nSize &&
+                current.nTime == source.nTime;
+        }
+
+        static uint64_t Mix(uint64_t nValue) noexcept
+        {
+            // splitmix64 finalizer
+            nValue ^= nValue >> 30;
+            nValue *= 0xBF58476D1CE4E5B9ull;
+            nValue ^= nValue >> 27;
+            nValue *= 0x94D049BB133111EBull;
+            nValue ^= nValue >> 31;
+            return nValue;
+        }
+
+        static uint64_t HashBytes(const char* pData, size_t nSize, uint64_t nHash = 0xCBF29CE484222325ull) noexcept
+        {
+            // 8바이트 단위 곱셈-회전 해시 (원본 검증/키 해시 공용)
+            size_t nIdx = 0;
+            for (; nIdx + 8 <= nSize; nIdx += 8)
+            {
+                uint64_t nWord = 0;
+                ::memcpy(&nWord, pData + nIdx, sizeof(uint64_t));
+                nHash = std::rotl((nHash ^ nWord) * 0x100000001B3ull, 29);
+            }
+            for (; nIdx < nSize; ++nIdx)
+            {
+                nHash = (nHash ^ static_cast<uint8_t>(pData[nIdx])) * 0x100000001B3ull;
+            }
+            return Mix(nHash ^ nSize);
+        }
+
+        static uint64_t HashKey(std::string_view svSection, std::string_view svKey) noexcept
+        {
+            return HashBytes(svKey.data(), svKey.size(), HashBytes(svSection.data(), svSection.size()));
+        }
+
+        static uint64_t GetSlot(uint64_t nHash, uint32_t nDisplacement, uint64_t nSlotCount) noexcept
+        {
+            return Mix(nHash + (static_cast<uint64_t>(nDisplacement) + 1) * 0x9E3779B97F4A7C15ull) % nSlotCount;
+        }
+
+        /**
+        * @brief        문서로 캐시 이미지를 만드는 함수 (완전 해시를 찾지 못하면 빈 문자열)
+        */
+        static std::string BuildImage(const IniDocument& doc, const SourceInfo& source)
+        {
+            // 중복 키는 조회 결과와 같은 처음 항목만 색인 (같은 키가 둘이면 완전 해시를 만들 수 없음)
+            std::vector<IniDocument::Entry> vEntries;
+            vEntries.reserve(doc.GetKeyCount());
+            for (const IniDocument::Entry& entry : doc.GetEntries())
+            {
+                if (doc.FindEntry(entry.svSection, entry.svKey) == &entry)
+                {
+                    vEntries.push_back(entry);
+                }
+            }
+            const uint64_t nCount = vEntries.size();
+            const uint64_t nBucketCount = nCount / 4 + 1;
+
+            std::vector<uint64_t> vHash(nCount);
+            std::vector<std::vector<uint32_t>> vBuckets(nBucketCount);
+            for (uint32_t i = 0; i < nCount; ++i)
+            {
+                vHash[i] = HashKey(vEntries[i].svSection, vEntries[i].svKey);
+                vBuckets[vHash[i] % nBucketCount].push_back(i);
+            }
+
+            std::vector<uint32_t> vOrder(nBucketCount);
+            for (uint32_t i = 0; i < nBucketCount; ++i)
+            {
+                vOrder[i] = i;
+            }
+            std::stable_sort(vOrder.begin(), vOrder.end(), [&vBuckets](uint32_t nLeft, uint32_t nRight)
+            {
+                return vBuckets[nLeft].size() > vBuckets[nRight].size();
+            });
+
+            // 키가 많은 버킷부터 모든 키가 빈 슬롯에 들어가는 변위를 찾음 (실패하면 슬롯을 늘려 재시도)
+            uint64_t nSlotCount = nCount + nCount / 4 + 1;
+            std::vector<uint32_t> vDisplacement(nBucketCount, 0);
+            std::vector<uint32_t> vSlots;
+            std::vector<uint64_t> vTrySlots;
+            bool bIsFound = false;
+            for (int nRetry = 0; nRetry < 4 && !bIsFound; ++nRetry, nSlotCount *= 2)
+            {
+                vSlots.assign(nSlotCount, EMPTY_SLOT);
+                bIsFound = true;
+                for (uint32_t nBucket : vOrder)
+                {
+                    const std::vector<uint32_t>& vKeys = vBuckets[nBucket];
+                    if (vKeys.empty())
+                    {
+                        break;
+                    }
+
+                    uint32_t nDisp = 0;
+                    for (; nDisp < MAX_DISPLACEMENT; ++nDisp)
+                    {
+                        vTrySlots.clear();
+                        bool bIsFree = true;
+                        for (uint32_t nKey : vKeys)
+                        {
+                            const uint64_t nSlot = GetSlot(vHash[nKey], nDisp, nSlotCount);
+                            if (vSlots[nSlot] != EMPTY_SLOT ||
+                                std::find(vTrySlots.begin(), vTrySlots.end(), nSlot) != vTrySlots.end())
+                            {
+                                bIsFree = false;
+                                break;
+                            }
+                            vTrySlots.push_back(nSlot);
+                        }
+                        if (bIsFree)
+                        {
+                            break;
+                        }
+                    }
+                    if (nDisp == MAX_DISPLACEMENT)
+                    {
+                        bIsFound = false;
+                        break;
+                    }
+
+                    vDisplacement[nBucket] = nDisp;
+                    for (size_t i = 0; i < vKeys.size(); ++i)
+                    {
+                        vSlots[vTrySlots[i]] = vKeys[i];
+                    }
+                }
+                if (bIsFound)
+                {
+                    break;
+                }
+            }
+            if (!bIsFound)
+            {
+                return std::string();
+            }
+
+            std::string strPool;
+            std::vector<CacheEntry> vCacheEntries(nCount);
+            auto addString = [&strPool](std::string_view svText, uint32_t* pOutOffset, uint32_t* pOutLength)
+            {
+                *pOutOffset = static_cast<uint32_t>(strPool.size());
+                *pOutLength = static_cast<uint32_t>(svText.size());
+                strPool.append(svText);
+                strPool.push_back('\0');
+            };
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                addString(vEntries[i].svSection, &vCacheEntries[i].nSection, &vCacheEntries[i].nSectionLength);
+                addString(vEntries[i].svKey, &vCacheEntries[i].nKey, &vCacheEntries[i].nKeyLength);
+                addString(vEntries[i].svValue, &vCacheEntries[i].nValue, &vCacheEntries[i].nValueLength);
+            }
+            if (strPool.size() > EMPTY_SLOT)
+            {
+                return std::string();
+            }
+
+            CacheHeader header{};
+            ::memcpy(header.arrMagic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+            header.nVersion = CACHE_VERSION;
+            header.nSourceSize = source.nSize;
+            header.nSourceTime = source.nTime;
+            header.nSourceHash = source.nHash;
+            header.nEntryCount = nCount;
+            header.nBucketCount = nBucketCount;
+            header.nSlotCount = nSlotCount;
+            header.nBucketOffset = sizeof(CacheHeader);
+            header.nSlotOffset = header.nBucketOffset + nBucketCount * sizeof(uint32_t);
+            header.nEntryOffset = header.nSlotOffset + nSlotCount * sizeof(uint32_t);
+            header.nStringOffset = header.nEntryOffset + nCount * sizeof(CacheEntry);
+            header.nStringSize = strPool.size();
+            header.nImageSize = header.nStringOffset + header.nStringSize;
+
+            std::string strImage(static_cast<size_t>(header.nImageSize), '\0');
+            ::memcpy(&strImage[0], &header, sizeof(CacheHeader));
+            ::memcpy(&strImage[header.nBucketOffset], vDisplacement.data(), nBucketCount * sizeof(uint32_t));
+            ::memcpy(&strImage[header.nSlotOffset], vSlots.data(), nSlotCount * sizeof(uint32_t));
+            if (nCount > 0)
+            {
+                ::memcpy(&strImage[header.nEntryOffset], vCacheEntries.data(), nCount * sizeof(CacheEntry));
+            }
+            ::memcpy(&strImage[header.nStringOffset], strPool.data(), strPool.size());
+            header.nBodyHash = HashBytes(strImage.data() + sizeof(CacheHeader), strImage.size() - sizeof(CacheHeader));
+            ::memcpy(&strImage[0], &header, sizeof(CacheHeader));
+            return strImage;
+        }
+
+        /**
+        * @brief        이미지 검증 (본문 해시와 모든 오프셋을 확인하여 손상된 캐시는 사용하지 않음)
+        */
+        static bool IsValidImage(const std::vector<char>& vImage)
+        {
+            if (vImage.size() < sizeof(CacheHeader))
+            {
+                return false;
+            }
+
+            CacheHeader header;
+            ::memcpy(&header, vImage.data(), sizeof(CacheHeader));
+            const uint64_t nSize = vImage.size();
+            if (::memcmp(header.arrMagic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+                header.nVersion != CACHE_VERSION ||
+                header.nImageSize != nSize ||
+                header.nBucketCount == 0 ||
+                header.nSlotCount == 0 ||
+                header.nEntryCount >= EMPTY_SLOT ||
+                header.nBucketCount > nSize / sizeof(uint32_t) ||
+                header.nSlotCount > nSize / sizeof(uint32_t) ||
+                header.nEntryCount > nSize / sizeof(CacheEntry) ||
+                header.nBucketOffset != sizeof(CacheHeader) ||
+                header.nSlotOffset != header.nBucketOffset + header.nBucketCount * sizeof(uint32_t) ||
+                header.nEntryOffset != header.nSlotOffset + header.nSlotCount * sizeof(uint32_t) ||
+                header.nStringOffset != header.nEntryOffset + header.nEntryCount * sizeof(CacheEntry) ||
+                header.nStringOffset + header.nStringSize != nSize ||
+                header.nBodyHash != HashBytes(vImage.data() + sizeof(CacheHeader), vImage.size() - sizeof(CacheHeader)))
+            {
+                return false;
+            }
+
+            for (uint64_t i = 0; i < header.nSlotCount; ++i)
+            {
+                uint32_t nSlot = 0;
+                ::memcpy(&nSlot, vImage.data() + header.nSlotOffset + i * sizeof(uint32_t), sizeof(uint32_t));
+                if (nSlot != EMPTY_SLOT &&
+                    nSlot >= header.nEntryCount)
+                {
+                    return false;
+                }
+            }
+            for (uint64_t i = 0; i < header.nEntryCount; ++i)
+            {
+                CacheEntry entry;
+                ::memcpy(&entry, vImage.data() + header.nEntryOffset + i * sizeof(CacheEntry), sizeof(CacheEntry));
+                if (static_cast<uint64_t>(entry.nSection) + entry.nSectionLength > header.nStringSize ||
+                    static_cast<uint64_t>(entry.nKey) + entry.nKeyLength > header.nStringSize ||
+                    static_cast<uint64_t>(entry.nValue) + entry.nValueLength > header.nStringSize)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void UseImage(std::vector<char>&& vImage)
+        {
+            m_vImage = std::move(vImage);
+            ::memcpy(&m_header, m_vImage.data(), sizeof(CacheHeader));
+            m_bIsFromCache = true;
+        }
+
+        CacheEntry ReadEntry(uint32_t nIndex) const noexcept
+        {
+            CacheEntry entry;
+            ::memcpy(&entry, m_vImage.data() + m_header.nEntryOffset + nIndex * sizeof(CacheEntry), sizeof(CacheEntry));
+            return entry;
+        }
+
+        std::string_view GetPoolString(uint32_t nOffset, uint32_t nLength) const noexcept
+        {
+            return std::string_view(m_vImage.data() + m_header.nStringOffset + nOffset, nLength);
+        }
+
+        uint32_t FindImageEntry(std::string_view svSection, std::string_view svKey) const noexcept
+        {
+            const uint64_t nHash = HashKey(svSection, svKey);
+            uint32_t nDisp = 0;
+            ::memcpy(&nDisp, m_vImage.data() + m_header.nBucketOffset + (nHash % m_header.nBucketCount) * sizeof(uint32_t), sizeof(uint32_t));
+            const uint64_t nSlot = GetSlot(nHash, nDisp, m_header.nSlotCount);
+
+            uint32_t nIndex = EMPTY_SLOT;
+            ::memcpy(&nIndex, m_vImage.data() + m_header.nSlotOffset + nSlot * sizeof(uint32_t), sizeof(uint32_t));
+            if (nIndex == EMPTY_SLOT)
+            {
+                return EMPTY_SLOT;
+            }
+
+            // 완전 해시는 없는 키도 어떤 슬롯으로 보내므로 실제 이름을 비교
+            const CacheEntry entry = ReadEntry(nIndex);
+            if (GetPoolString(entry.nKey, entry.nKeyLength) != svKey ||
+                GetPoolString(entry.nSection, entry.nSectionLength) != svSection)
+            {
+                return EMPTY_SLOT;
+            }
+            return nIndex;
         }
 
-        ::sprintf_s(szFormattedSection, MAX_LENGTH, "[%s]", szSection);
-        nFormattedSectionLength = static_cast<int>(::strlen(szFormattedSection));
+        std::vector<char> m_vImage;
+        CacheHeader m_header{};
+        bool m_bIsFromCache = false;
+        IniDocument m_doc;
+    };
+
+    /**
+    * @brief        INI 파일 변경을 감시하여 다시 읽고, 읽은 결과를 변경 불가 스냅샷으로 공개하는 설정 관리자
+    * @details      감시 스레드가 주기적으로 파일의 수정 시각과 크기를 확인하고, 바뀌었으면 새 IniDocument를 만든 뒤
+    *               atomic shared_ptr로 교체한다. 문서는 교체 전에 완성되므로 읽는 쪽은 재로드를 기다리지 않는다.
+    *               핫 패스에서는 스레드마다 Reader를 두고 사용한다. Reader는 버전 번호만 확인하고 바뀌었을 때만 스냅샷을 다시 받는다.
+    *               파일을 읽지 못하면 (삭제, 열기 실패 등) 이전 스냅샷을 유지한다.
+    */
+    class IniConfig
+    {
+    public:
+        using Snapshot = std::shared_ptr<const IniDocument>;
+        using ReloadCallback = std::function<void(const Snapshot& pSnapshot)>;
 
-        // Section Check
-        do
+        /**
+        * @brief        스레드별 읽기 핸들 (하나의 Reader를 여러 스레드에서 공유하지 말 것)
+        */
+        class Reader
         {
-            if (::fgets(szBuffer, MAX_LENGTH - 1, pFile) == nullptr)
+        public:
+            explicit Reader(const IniConfig& config)
+                : m_pConfig(&config)
+                , m_nVersion(0)
+            {
+            }
+
+            /**
+            * @brief        현재 문서를 받아오는 함수 (버전이 같으면 원자 변수 하나만 읽음)
+            * @return       현재 문서 (다음 Get() 호출 전까지 유효)
+            */
+            const IniDocument& Get()
             {
-                ::fclose(pFile);
-                ::strcpy_s(szOutBuffer, nBufferSize, szDefault);
-                return static_cast<int>(::strlen(szOutBuffer));
+                const uint64_t nVersion = m_pConfig->m_nVersion.load(std::memory_order_acquire);
+                if (m_pSnapshot == nullptr ||
+                    nVersion != m_nVersion)
+                {
+                    m_pSnapshot = m_pConfig->GetSnapshot();
+                    m_nVersion = nVersion;
+                }
+                return *m_pSnapshot;
             }
-        } while (::strncmp(szBuffer, szFormattedSection, nFormattedSectionLength));
 
-        // Key Check
-        do
+        private:
+            const IniConfig* m_pConfig;
+            Snapshot m_pSnapshot;
+            uint64_t m_nVersion;
+        };
+
+        /**
+        * @param[in]    strFileName     감시할 INI 파일의 경로
+        * @param[in]    pollInterval    변경 확인 주기
+        */
+        explicit IniConfig(std::string strFileName, std::chrono::milliseconds pollInterval = std::chrono::milliseconds(1000))
+            : m_strFileName(std::move(strFileName))
+            , m_pollInterval(pollInterval)
+            , m_pSnapshot(std::make_shared<const IniDocument>())
+            , m_nVersion(0)
+            , m_bIsStop(false)
+        {
+        }
+
+        IniConfig(const IniConfig&) = delete;
+        IniConfig& operator=(const IniConfig&) = delete;
+
+        ~IniConfig()
+        {
+            Stop();
+        }
+
+        /**
+        * @brief        재로드 때마다 감시 스레드에서 호출될 함수 등록 (Start() 전에 호출)
+        */
+        void SetReloadCallback(ReloadCallback callback)
         {
-            if (::fgets(szBuffer, MAX_LENGTH - 1, pFile) == nullptr)
+            m_callback = std::move(callback);
+        }
+
+        /**
+        * @brief        파일을 처음 읽고 감시 스레드를 시작하는 함수
+        * @return       true: 성공, false: 처음 읽기 실패 (감시를 시작하지 않음)
+        */
+        bool Start()
+        {
+            if (m_thread.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutexStop);
+                    if (!m_bIsStop)
+                    {
+                        return true;
+                    }
+                }
+                // 콜백 안에서 Stop된 뒤 아직 join되지 않은 감시 스레드 (감시 스레드 자신은 재시작 불가)
+                if (IsWatchThread())
+                {
+                    return false;
+                }
+                m_thread.join();
+            }
+            if (!Reload())
             {
-                ::fclose(pFile);
-                ::strcpy_s(szOutBuffer, nBufferSize, szDefault);
-                return static_cast<int>(::strlen(szOutBuffer));
+                return false;
             }
-        } while (::strncmp(szBuffer, szKey, nKeyLength));
 
-        ::fclose(pFile);
+            m_bIsStop = false;
+            m_thread = std::thread([this]()
+            {
+                m_watchThreadId.store(std::this_thread::get_id(), std::memory_order_release);
+                std::unique_lock<std::mutex> lock(m_mutexStop);
+                while (!m_cvStop.wait_for(lock, m_pollInterval, [this]() { return m_bIsStop; }))
+                {
+                    lock.unlock();
+                    if (IsChanged())
+                    {
+                        Reload();
+                    }
+                    lock.lock();
+                }
+                m_watchThreadId.store(std::thread::id(), std::memory_order_release);
+            });
+            return true;
+        }
+
+        /**
+        * @brief        감시 스레드 종료 (콜백 안에서 호출하면 종료만 알리고, join은 다음 Start/Stop 또는 소멸자에서 함)
+        */
+        void Stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutexStop);
+                m_bIsStop = true;
+            }
+            m_cvStop.notify_all();
+            if (IsWatchThread())
+            {
+                return;
+            }
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
 
-        // Check Equals
-        pEqual = ::strchr(szBuffer, '=');
-        if (pEqual == nullptr)
+        /**
+        * @brief        파일을 즉시 다시 읽는 함수 (변경 여부와 무관)
+        * @details      콜백은 잠금을 풀고 호출하므로 콜백 안에서 Reload/Stop을 불러도 된다.
+        *               여러 스레드에서 동시에 재로드하면 콜백 순서가 공개 순서와 다를 수 있으므로 최신 문서는 GetSnapshot으로 확인할 것.
+        * @return       true: 새 스냅샷 공개, false: 읽기 실패 (이전 스냅샷 유지)
+        */
+        bool Reload()
         {
-            ::strncpy_s(szOutBuffer, nBufferSize, szDefault, nBufferSize);
-            return static_cast<int>(::strlen(szOutBuffer));
+            Snapshot pSnapshot;
+            {
+                std::lock_guard<std::mutex> lock(m_mutexReload);
+                std::error_code errCode;
+                const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(m_strFileName, errCode);
+                const uintmax_t nFileSize = std::filesystem::file_size(m_strFileName, errCode);
+
+                std::shared_ptr<IniDocument> pDoc = std::make_shared<IniDocument>();
+                if (!pDoc->LoadFile(m_strFileName.c_str()))
+                {
+                    return false;
+                }
+
+                pSnapshot = std::move(pDoc);
+                m_writeTime = writeTime;
+                m_nFileSize = nFileSize;
+                m_pSnapshot.store(pSnapshot, std::memory_order_release);
+                m_nVersion.fetch_add(1, std::memory_order_release);
+            }
+
+            if (m_callback)
+            {
+                m_callback(pSnapshot);
+            }
+            return true;
         }
-        ++pEqual;
 
-        // Remove leading spaces
-        while (*pEqual &&
-            (::isspace(*pEqual) || *pEqual == CHAR_LF))
+        /**
+        * @brief        현재 스냅샷을 받아오는 함수 (받은 스냅샷은 재로드 후에도 유효)
+        */
+        Snapshot GetSnapshot() const
         {
-            ++pEqual;
+            return m_pSnapshot.load(std::memory_order_acquire);
         }
-        if (pEqual == nullptr)
+
+        /**
+        * @brief        공개된 스냅샷 수 (재로드마다 1 증가)
+        */
+        uint64_t GetVersion() const noexcept
         {
-            ::strncpy_s(szOutBuffer, nBufferSize, szDefault, nBufferSize);
-            return static_cast<int>(::strlen(szOutBuffer));
+            return m_nVersion.load(std::memory_order_acquire);
         }
 
-        // Remove trailing spaces
-        pCh = pEqual;
-        while (*pCh)
+    private:
+        /**
+        * @brief        감시 스레드(콜백 안)에서 호출되었는지 여부 (m_thread는 Start가 대입하는 동안 감시 스레드가 읽을 수 없으므로 따로 기록)
+        */
+        bool IsWatchThread() const noexcept
         {
-            ++pCh;
+            return m_watchThreadId.load(std::memory_order_acquire) == std::this_thread::get_id();
         }
 
-        // Backup and put in nulls if there is a space
-        --pCh;
-        while (pCh > pEqual)
+        bool IsChanged()
         {
-            if (::isspace(*pCh) ||
-                *pEqual == CHAR_LF)
+            std::error_code errCode;
+            const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(m_strFileName, errCode);
+            if (errCode)
             {
-                *pCh = 0;
-                --pCh;
+                return false;
             }
-            else
+            const uintmax_t nFileSize = std::filesystem::file_size(m_strFileName, errCode);
+            if (errCode)
             {
-                break;
+                return false;
             }
+
+            std::lock_guard<std::mutex> lock(m_mutexReload);
+            return writeTime != m_writeTime || nFileSize != m_nFileSize;
+        }
+
+        std::string m_strFileName;
+        std::chrono::milliseconds m_pollInterval;
+        ReloadCallback m_callback;
+
+        std::atomic<Snapshot> m_pSnapshot;
+        std::atomic<uint64_t> m_nVersion;
+
+        std::mutex m_mutexReload;
+        std::filesystem::file_time_type m_writeTime;
+        uintmax_t m_nFileSize = 0;
+
+        std::thread m_thread;
+        std::atomic<std::thread::id> m_watchThreadId;
+        std::mutex m_mutexStop;
+        std::condition_variable m_cvStop;
+        bool m_bIsStop;
+    };
+
+    /**
+    * @brief        INI 파일에서 데이터를 받아오는 함수
+    * @details      호출마다 파일을 읽으므로 여러 키를 읽을 때는 IniDocument를 한 번 만들어 사용할 것
+    * @param[in]    szSection       INI 파일에서 읽어올 데이터의 섹션 이름
+    * @param[in]    szKey           INI 파일에서 읽어올 데이터 키의 이름
+    * @param[in]    szDefault       INI 파일에서 해당 값이 없을 때 반환해줄 기본값
+    * @param[out]   szOutBuffer     INI 파일에서 읽어온 데이터
+    * @param[in]    nBufferSize     읽어올 데이터 버퍼의 최대 길이
+    * @param[in]    szFileName      INI 파일의 경로 (전체 경로)
+    * @return       읽어온 데이터의 길이 (읽어오지 못했다면 0)
+    */
+    inline int GetIniString(const char* szSection,
+        const char* szKey,
+        const char* szDefault,
+        char* szOutBuffer,
+        const int& nBufferSize,
+        const char* szFileName)
+    {
+        if (szSection == nullptr ||
+            szKey == nullptr ||
+            szOutBuffer == nullptr ||
+            nBufferSize <= 0)
+        {
+            return 0;
         }
 
-        // Copy up to nBufferSize chars to outBuffer
-        ::strncpy_s(szOutBuffer, nBufferSize - 1, pEqual, nBufferSize - 1);
+        IniDocument doc;
+        if (!doc.LoadFile(szFileName))
+        {
+            return 0;
+        }
 
-        szOutBuffer[nBufferSize] = '\0';
-        return static_cast<int>(::strlen(szOutBuffer));
+        std::string_view svValue = doc.GetString(szSection, szKey, szDefault != nullptr ? szDefault : "");
+        const size_t nCopy = svValue.size() < static_cast<size_t>(nBufferSize - 1) ? svValue.size() : static_cast<size_t>(nBufferSize - 1);
+        ::memcpy(szOutBuffer, svValue.data(), nCopy);
+        szOutBuffer[nCopy] = '\0';
+        return static_cast<int>(nCopy);
     }
-} // namespace esk::util_ini
+} // namespace esk::util_ini
\ No newline at end of file
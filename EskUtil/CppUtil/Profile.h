@@ -0,0 +1,470 @@
+﻿/**
+* @file			Profile.h
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		Profile Utility (구간 시간 측정, 지연 시간 히스토그램)
+*/
+
+#pragma once
+#include "Common.h"
+#include "Time.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+* 사용 예)
+*   void Update()
+*   {
+*       ESK_PROFILE_SCOPE("Update");     // 함수가 끝날 때 걸린 시간을 "Update" 프로브에 기록
+*       ...
+*   }
+*   std::string strReport = esk::gearforge::util::profile::ProfileRegistry::GetInstance().DumpText();
+*
+* ESK_PROFILE_DISABLE을 정의하면 매크로는 아무 코드도 만들지 않는다.
+*/
+#if defined(ESK_PROFILE_DISABLE)
+    #define ESK_PROFILE_SCOPE(name) ((void)0)
+    #define ESK_PROFILE_RECORD_NANOS(name, nanos) ((void)0)
+#else
+    #define ESK_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define ESK_PROFILE_CONCAT(a, b) ESK_PROFILE_CONCAT_IMPL(a, b)
+    // MSVC /ZI에서는 __LINE__을 이어 붙일 수 없으므로 __COUNTER__ 사용
+    #define ESK_PROFILE_SCOPE_IMPL(name, id) \
+        static ::esk::gearforge::util::profile::Probe ESK_PROFILE_CONCAT(s_eskProbe, id)(name); \
+        ::esk::gearforge::util::profile::ScopedTimer ESK_PROFILE_CONCAT(eskScopedTimer, id)(ESK_PROFILE_CONCAT(s_eskProbe, id))
+    #define ESK_PROFILE_SCOPE(name) ESK_PROFILE_SCOPE_IMPL(name, __COUNTER__)
+    #define ESK_PROFILE_RECORD_NANOS(name, nanos) \
+        do \
+        { \
+            static ::esk::gearforge::util::profile::Probe s_eskProbe(name); \
+            s_eskProbe.RecordNanos(nanos); \
+        } while (false)
+#endif
+
+namespace esk::gearforge::util::profile
+{
+    /**
+    * @brief        HDR 방식(로그-선형 버킷) 지연 시간 히스토그램
+    * @details      2^(SUB_BITS+1) 미만은 값 그대로, 그 이상은 2의 거듭제곱 구간마다 2^SUB_BITS개로 나눠 상대 오차 1/64 이하
+    *               MAX_BITS 비트를 넘는 값은 마지막 버킷에 넣는다.
+    *               Record는 한 스레드만 호출해야 하며(단일 작성자, RMW 없는 relaxed load/store),
+    *               다른 스레드는 언제든 Merge로 읽을 수 있다.
+    */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr uint32_t SUB_BITS = 6;
+        static constexpr uint32_t SUB_COUNT = 1u << SUB_BITS;
+        static constexpr uint32_t MAX_BITS = 44;
+        static constexpr uint32_t BUCKET_COUNT = (MAX_BITS - SUB_BITS + 1) * SUB_COUNT;
+
+        /**
+        * @brief        값이 들어갈 버킷 번호
+        */
+        static uint32_t GetBucketIndex(uint64_t nValue) noexcept
+        {
+            if (nValue < 2 * SUB_COUNT)
+            {
+                return static_cast<uint32_t>(nValue);
+            }
+            const uint32_t nShift = static_cast<uint32_t>(std::bit_width(nValue)) - (SUB_BITS + 1);
+            const uint32_t nIdx = (nShift + 1) * SUB_COUNT + static_cast<uint32_t>(nValue >> nShift) - SUB_COUNT;
+            return nIdx < BUCKET_COUNT ? nIdx : BUCKET_COUNT - 1;
+        }
+
+        /**
+        * @brief        버킷이 담는 가장 큰 값
+        */
+        static uint64_t GetBucketUpperValue(uint32_t nIdx) noexcept
+        {
+            if (nIdx < 2 * SUB_COUNT)
+            {
+                return nIdx;
+            }
+            const uint32_t nShift = nIdx / SUB_COUNT - 1;
+            const uint64_t nBase = static_cast<uint64_t>(nIdx % SUB_COUNT + SUB_COUNT) << nShift;
+            return nBase + ((1ull << nShift) - 1);
+        }
+
+        void Record(uint64_t nValue) noexcept
+        {
+            Increase(m_arrCounts[GetBucketIndex(nValue)], 1);
+            Increase(m_nCount, 1);
+            Increase(m_nSum, nValue);
+            if (nValue > m_nMax.load(std::memory_order_relaxed))
+            {
+                m_nMax.store(nValue, std::memory_order_relaxed);
+            }
+            if (nValue < m_nMin.load(std::memory_order_relaxed))
+            {
+                m_nMin.store(nValue, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+        * @brief        다른 히스토그램을 더하는 함수 (this는 호출 스레드만 쓰는 히스토그램이어야 함)
+        */
+        void Merge(const LatencyHistogram& other) noexcept
+        {
+            for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                const uint64_t nCount = other.m_arrCounts[i].load(std::memory_order_relaxed);
+                if (nCount != 0)
+                {
+                    Increase(m_arrCounts[i], nCount);
+                }
+            }
+            Increase(m_nCount, other.m_nCount.load(std::memory_order_relaxed));
+            Increase(m_nSum, other.m_nSum.load(std::memory_order_relaxed));
+            m_nMax.store((std::max)(m_nMax.load(std::memory_order_relaxed), other.m_nMax.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            m_nMin.store((std::min)(m_nMin.load(std::memory_order_relaxed), other.m_nMin.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief        모든 값을 지우는 함수 (기록 중인 스레드가 있으면 그 순간의 값 일부가 남을 수 있음)
+        */
+        void Reset() noexcept
+        {
+            for (std::atomic<uint64_t>& nCount : m_arrCounts)
+            {
+                nCount.store(0, std::memory_order_relaxed);
+            }
+            m_nCount.store(0, std::memory_order_relaxed);
+            m_nSum.store(0, std::memory_order_relaxed);
+            m_nMax.store(0, std::memory_order_relaxed);
+            m_nMin.store(UINT64_MAX, std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief        백분위 값 (해당 버킷의 상한, nPercentile: 0 ~ 100)
+        */
+        uint64_t GetPercentile(double dPercentile) const noexcept
+        {
+            const uint64_t nTotal = GetCount();
+            if (nTotal == 0)
+            {
+                return 0;
+            }
+
+            uint64_t nRank = static_cast<uint64_t>(dPercentile / 100.0 * static_cast<double>(nTotal) + 0.5);
+            nRank = std::clamp<uint64_t>(nRank, 1, nTotal);
+            uint64_t nSeen = 0;
+            for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                nSeen += m_arrCounts[i].load(std::memory_order_relaxed);
+                if (nSeen >= nRank)
+                {
+                    return (std::min)(GetBucketUpperValue(i), GetMax());
+                }
+            }
+            return GetMax();
+        }
+
+        uint64_t GetCount() const noexcept
+        {
+            return m_nCount.load(std::memory_order_relaxed);
+        }
+
+        uint64_t GetSum() const noexcept
+        {
+            return m_nSum.load(std::memory_order_relaxed);
+        }
+
+        uint64_t GetMax() const noexcept
+        {
+            return m_nMax.load(std::memory_order_relaxed);
+        }
+
+        uint64_t GetMin() const noexcept
+        {
+            return GetCount() == 0 ? 0 : m_nMin.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static void Increase(std::atomic<uint64_t>& nValue, uint64_t nAdd) noexcept
+        {
+            nValue.store(nValue.load(std::memory_order_relaxed) + nAdd, std::memory_order_relaxed);
+        }
+
+        std::atomic<uint64_t> m_nCount{ 0 };
+        std::atomic<uint64_t> m_nSum{ 0 };
+        std::atomic<uint64_t> m_nMax{ 0 };
+        std::atomic<uint64_t> m_nMin{ UINT64_MAX };
+        std::atomic<uint64_t> m_arrCounts[BUCKET_COUNT]{};
+    };
+
+    /**
+    * @brief        프로브 하나의 집계 결과 (나노초)
+    */
+    struct ProbeReport
+    {
+        std::string strName;
+        uint64_t nCount = 0;
+        double dMeanNanos = 0.0;
+        uint64_t nMinNanos = 0;
+        uint64_t nP50Nanos = 0;
+        uint64_t nP99Nanos = 0;
+        uint64_t nP999Nanos = 0;
+        uint64_t nMaxNanos = 0;
+    };
+
+    /**
+    * @brief        프로브 이름과 스레드별 히스토그램을 관리하는 전역 레지스트리
+    * @details      기록은 각 스레드의 히스토그램에만 쓰고(잠금 없음), 집계할 때 잠금을 잡고 모든 스레드 것을 합친다.
+    *               종료된 스레드의 히스토그램은 종료 시점에 보관용 히스토그램으로 합쳐진다.
+    *               값은 TSC 틱으로 저장하고 보고할 때 나노초로 바꾼다.
+    */
+    class ProfileRegistry
+    {
+    public:
+        static ProfileRegistry& GetInstance()
+        {
+            static ProfileRegistry registry;
+            return registry;
+        }
+
+        ProfileRegistry(const ProfileRegistry&) = delete;
+        ProfileRegistry& operator=(const ProfileRegistry&) = delete;
+
+        /**
+        * @brief        이름으로 프로브 번호를 찾거나 새로 등록하는 함수 (같은 이름은 같은 번호)
+        */
+        uint32_t RegisterProbe(const char* pszName)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (uint32_t i = 0; i < m_vNames.size(); ++i)
+            {
+                if (m_vNames[i] == pszName)
+                {
+                    return i;
+                }
+            }
+            m_vNames.emplace_back(pszName);
+            m_vRetired.push_back(std::make_unique<LatencyHistogram>());
+            return static_cast<uint32_t>(m_vNames.size() - 1);
+        }
+
+        /**
+        * @brief        현재 스레드의 nProbeId 히스토그램에 틱 값을 기록하는 함수
+        */
+        void RecordTicks(uint32_t nProbeId, uint64_t nTicks)
+        {
+            ThreadState& state = GetThreadState();
+            if (nProbeId >= state.vHistograms.size() ||
+                state.vHistograms[nProbeId] == nullptr)
+            {
+                AddThreadHistogram(&state, nProbeId);
+            }
+            state.vHistograms[nProbeId]->Record(nTicks);
+        }
+
+        /**
+        * @brief        모든 스레드의 기록을 합쳐 프로브별 결과를 만드는 함수
+        */
+        std::vector<ProbeReport> Collect()
+        {
+            const time::TSCCalibration& calib = time::GetTSCCalibration();
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            std::vector<ProbeReport> vReports;
+            vReports.reserve(m_vNames.size());
+            std::unique_ptr<LatencyHistogram> pMerged = std::make_unique<LatencyHistogram>();
+            for (uint32_t nId = 0; nId < m_vNames.size(); ++nId)
+            {
+                pMerged->Reset();
+                pMerged->Merge(*m_vRetired[nId]);
+                for (ThreadState* pState : m_vThreads)
+                {
+                    if (nId < pState->vHistograms.size() &&
+                        pState->vHistograms[nId] != nullptr)
+                    {
+                        pMerged->Merge(*pState->vHistograms[nId]);
+                    }
+                }
+
+                ProbeReport report;
+                report.strName = m_vNames[nId];
+                report.nCount = pMerged->GetCount();
+                report.dMeanNanos = report.nCount == 0 ? 0.0 : static_cast<double>(calib.TicksToNanos(pMerged->GetSum())) / static_cast<double>(report.nCount);
+                report.nMinNanos = calib.TicksToNanos(pMerged->GetMin());
+                report.nP50Nanos = calib.TicksToNanos(pMerged->GetPercentile(50.0));
+                report.nP99Nanos = calib.TicksToNanos(pMerged->GetPercentile(99.0));
+                report.nP999Nanos = calib.TicksToNanos(pMerged->GetPercentile(99.9));
+                report.nMaxNanos = calib.TicksToNanos(pMerged->GetMax());
+                vReports.push_back(std::move(report));
+            }
+            return vReports;
+        }
+
+        /**
+        * @brief        Collect 결과를 표 형태의 문자열로 만드는 함수 (호출 횟수가 0인 프로브 제외)
+        */
+        std::string DumpText()
+        {
+            std::string strText;
+            char szLine[256];
+            std::snprintf(szLine, sizeof(szLine), "%-32s %12s %12s %12s %12s %12s %12s\n",
+                "probe", "count", "mean(ns)", "p50(ns)", "p99(ns)", "p999(ns)", "max(ns)");
+            strText += szLine;
+            for (const ProbeReport& report : Collect())
+            {
+                if (report.nCount == 0)
+                {
+                    continue;
+                }
+                std::snprintf(szLine, sizeof(szLine), "%-32s %12llu %12.1f %12llu %12llu %12llu %12llu\n",
+                    report.strName.c_str(),
+                    static_cast<unsigned long long>(report.nCount), report.dMeanNanos,
+                    static_cast<unsigned long long>(report.nP50Nanos), static_cast<unsigned long long>(report.nP99Nanos),
+                    static_cast<unsigned long long>(report.nP999Nanos), static_cast<unsigned long long>(report.nMaxNanos));
+                strText += szLine;
+            }
+            return strText;
+        }
+
+        /**
+        * @brief        모든 기록을 지우는 함수 (프로브 등록은 유지)
+        */
+        void Reset()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (std::unique_ptr<LatencyHistogram>& pHistogram : m_vRetired)
+            {
+                pHistogram->Reset();
+            }
+            for (ThreadState* pState : m_vThreads)
+            {
+                for (std::unique_ptr<LatencyHistogram>& pHistogram : pState->vHistograms)
+                {
+                    if (pHistogram != nullptr)
+                    {
+                        pHistogram->Reset();
+                    }
+                }
+            }
+        }
+
+    private:
+        /**
+        * @brief        스레드별 히스토그램 목록 (프로브 번호로 색인, 처음 기록할 때 생성)
+        */
+        struct ThreadState
+        {
+            std::vector<std::unique_ptr<LatencyHistogram>> vHistograms;
+            bool bIsRegistered = false;
+
+            ~ThreadState()
+            {
+                if (bIsRegistered)
+                {
+                    ProfileRegistry::GetInstance().RetireThread(this);
+                }
+            }
+        };
+
+        ProfileRegistry() = default;
+
+        static ThreadState& GetThreadState()
+        {
+            thread_local ThreadState state;
+            return state;
+        }
+
+        void AddThreadHistogram(ThreadState* pState, uint32_t nProbeId)
+        {
+            // 집계 중인 스레드가 목록을 읽고 있을 수 있으므로 구조 변경은 잠금 안에서만
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!pState->bIsRegistered)
+            {
+                m_vThreads.push_back(pState);
+                pState->bIsRegistered = true;
+            }
+            if (nProbeId >= pState->vHistograms.size())
+            {
+                pState->vHistograms.resize(nProbeId + 1);
+            }
+            pState->vHistograms[nProbeId] = std::make_unique<LatencyHistogram>();
+        }
+
+        void RetireThread(ThreadState* pState)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (uint32_t nId = 0; nId < pState->vHistograms.size(); ++nId)
+            {
+                if (pState->vHistograms[nId] != nullptr)
+                {
+                    m_vRetired[nId]->Merge(*pState->vHistograms[nId]);
+                }
+            }
+            m_vThreads.erase(std::remove(m_vThreads.begin(), m_vThreads.end(), pState), m_vThreads.end());
+        }
+
+        std::mutex m_mutex;
+        std::vector<std::string> m_vNames;
+        std::vector<std::unique_ptr<LatencyHistogram>> m_vRetired;
+        std::vector<ThreadState*> m_vThreads;
+    };
+
+    /**
+    * @brief        이름 붙은 측정 지점 (보통 ESK_PROFILE_SCOPE가 함수 안 static으로 만든다)
+    */
+    class Probe
+    {
+    public:
+        explicit Probe(const char* pszName)
+            : m_nId(ProfileRegistry::GetInstance().RegisterProbe(pszName))
+        {
+        }
+
+        void RecordTicks(uint64_t nTicks)
+        {
+            ProfileRegistry::GetInstance().RecordTicks(m_nId, nTicks);
+        }
+
+        void RecordNanos(uint64_t nNanos)
+        {
+            RecordTicks(static_cast<uint64_t>(static_cast<double>(nNanos) * time::GetTSCCalibration().dTicksPerNanos));
+        }
+
+        uint32_t GetId() const noexcept
+        {
+            return m_nId;
+        }
+
+    private:
+        uint32_t m_nId;
+    };
+
+    /**
+    * @brief        생성부터 소멸까지 걸린 시간을 프로브에 기록하는 RAII 타이머 (rdtsc 2번)
+    */
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Probe& probe) noexcept
+            : m_probe(probe)
+            , m_nStartTick(time::ReadTSC())
+        {
+        }
+
+        ~ScopedTimer()
+        {
+            m_probe.RecordTicks(time::ReadTSC() - m_nStartTick);
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Probe& m_probe;
+        uint64_t m_nStartTick;
+    };
+} // namespace esk::util_profile
\ No newline at end of file
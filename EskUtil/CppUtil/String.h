@@ -1,19 +1,37 @@
 ﻿/**
 * @file			String.h
 * @author		yc.jeon (Eskeptor)
-* @date			2026-04-21
-* @version		0.0.3
+* @date			2026-10-18
+* @version		0.0.4
 * @brief		std::string Utility
 */
 
 #pragma once
 #include "Common.h"
+#include "FileIO.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <compare>
+#include <cstdio>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if __has_include(<format>)
+#include <format>
+#endif
 
 namespace esk::gearforge::util::str
 {
     /**
     * @brief        입력된 buffer 배열을 새로 복사하여 반환하는 함수 (new 하기 때문에 delete 필요!!)
+    * @details      많은 문자열을 복사해야 한다면 StringArena::CopyCString을 사용할 것 (개별 delete 불필요)
     * @param[in]    buffer          복사할 char 배열
     * @return       복사 된 char 배열 (delete 필요)
     */
@@ -29,4 +47,2059 @@ namespace esk::gearforge::util::str
         ::memcpy_s(pCopy, nSize + 1, pszBuffer, nSize + 1);
         return pCopy;
     }
-} // namespace esk::util_str
\ No newline at end of file
+
+    namespace detail
+    {
+        inline uint64_t MixHash(uint64_t nValue) noexcept
+        {
+            nValue ^= nValue >> 30;
+            nValue *= 0xBF58476D1CE4E5B9ull;
+            nValue ^= nValue >> 27;
+            nValue *= 0x94D049BB133111EBull;
+            nValue ^= nValue >> 31;
+            return nValue;
+        }
+    } // namespace detail
+
+    /**
+    * @brief        문자열 해시 (8바이트 단위 곱셈-회전 + splitmix64 마무리, 암호학적 용도 아님)
+    */
+    inline uint64_t HashString(std::string_view svText) noexcept
+    {
+        const char* pData = svText.data();
+        const size_t nSize = svText.size();
+        uint64_t nHash = 0x9E3779B97F4A7C15ull ^ nSize;
+        size_t nIdx = 0;
+        for (; nIdx + 8 <= nSize; nIdx += 8)
+        {
+            uint64_t nWord = 0;
+            ::memcpy(&nWord, pData + nIdx, sizeof(uint64_t));
+            nHash = std::rotl(nHash ^ (nWord * 0x87C37B91114253D5ull), 31) * 0x4CF5AD432745937Full;
+        }
+        if (nIdx < nSize)
+        {
+            uint64_t nWord = 0;
+            ::memcpy(&nWord, pData + nIdx, nSize - nIdx);
+            nHash = std::rotl(nHash ^ (nWord * 0x87C37B91114253D5ull), 31) * 0x4CF5AD432745937Full;
+        }
+        return detail::MixHash(nHash);
+    }
+
+    /**
+    * @brief        블록 단위로 메모리를 잡아 두고 포인터만 증가시켜 문자열을 복사하는 아레나
+    * @details      개별 해제는 없으며 Reset()으로 한 번에 비운다. (블록은 유지되어 다음 사용 시 재사용)
+    *               반환된 문자열은 항상 '\0'으로 끝나며, Reset()/Release() 또는 아레나가 소멸되기 전까지 유효하다.
+    *               스레드 안전하지 않으므로 스레드마다 따로 쓰거나 GetThreadArena()를 사용한다.
+    */
+    class StringArena
+    {
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit StringArena(size_t nBlockSize = DEFAULT_BLOCK_SIZE) noexcept
+            : m_nBlockSize(nBlockSize > 0 ? nBlockSize : DEFAULT_BLOCK_SIZE)
+        {
+        }
+
+        StringArena(const StringArena&) = delete;
+        StringArena& operator=(const StringArena&) = delete;
+
+        StringArena(StringArena&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        StringArena& operator=(StringArena&& other) noexcept
+        {
+            if (this != &other)
+            {
+                m_vBlocks = std::move(other.m_vBlocks);
+                m_nBlockSize = other.m_nBlockSize;
+                m_nBlockIndex = std::exchange(other.m_nBlockIndex, 0);
+                m_pCur = std::exchange(other.m_pCur, nullptr);
+                m_pEnd = std::exchange(other.m_pEnd, nullptr);
+                m_nUsedSize = std::exchange(other.m_nUsedSize, 0);
+                other.m_vBlocks.clear();
+            }
+            return *this;
+        }
+
+        /**
+        * @brief        정렬된 메모리를 할당하는 함수
+        * @param[in]    nSize           바이트 수
+        * @param[in]    nAlign          정렬 (2의 거듭제곱)
+        */
+        void* Allocate(size_t nSize, size_t nAlign = 1)
+        {
+            uintptr_t nCur = reinterpret_cast<uintptr_t>(m_pCur);
+            uintptr_t nAligned = (nCur + nAlign - 1) & ~static_cast<uintptr_t>(nAlign - 1);
+            if (m_pCur == nullptr ||
+                nAligned + nSize > reinterpret_cast<uintptr_t>(m_pEnd))
+            {
+                NextBlock(nSize + nAlign - 1);
+                nCur = reinterpret_cast<uintptr_t>(m_pCur);
+                nAligned = (nCur + nAlign - 1) & ~static_cast<uintptr_t>(nAlign - 1);
+            }
+
+            m_pCur = reinterpret_cast<char*>(nAligned + nSize);
+            m_nUsedSize += nSize;
+            return reinterpret_cast<void*>(nAligned);
+        }
+
+        /**
+        * @brief        문자열을 아레나로 복사하는 함수 ('\0' 종료 포함)
+        */
+        std::string_view Copy(std::string_view svText)
+        {
+            char* pCopy = static_cast<char*>(Allocate(svText.size() + 1));
+            if (!svText.empty())
+            {
+                ::memcpy(pCopy, svText.data(), svText.size());
+            }
+            pCopy[svText.size()] = '\0';
+            return std::string_view(pCopy, svText.size());
+        }
+
+        /**
+        * @brief        AllocCopyCString 대체 함수 (delete 불필요)
+        */
+        const char* CopyCString(const char* pszText)
+        {
+            if (pszText == nullptr)
+            {
+                return nullptr;
+            }
+            return Copy(std::string_view(pszText)).data();
+        }
+
+        /**
+        * @brief        모든 문자열을 한 번에 해제 (블록은 재사용을 위해 유지)
+        */
+        void Reset() noexcept
+        {
+            m_nBlockIndex = 0;
+            m_nUsedSize = 0;
+            if (m_vBlocks.empty())
+            {
+                m_pCur = nullptr;
+                m_pEnd = nullptr;
+            }
+            else
+            {
+                m_pCur = m_vBlocks[0].pData.get();
+                m_pEnd = m_pCur + m_vBlocks[0].nSize;
+            }
+        }
+
+        /**
+        * @brief        모든 블록을 운영체제에 반환
+        */
+        void Release() noexcept
+        {
+            m_vBlocks.clear();
+            m_vBlocks.shrink_to_fit();
+            Reset();
+        }
+
+        /**
+        * @brief        할당된 바이트 수 (정렬 여백 제외)
+        */
+        size_t GetUsedSize() const noexcept
+        {
+            return m_nUsedSize;
+        }
+
+        /**
+        * @brief        잡아 둔 전체 블록 크기
+        */
+        size_t GetCapacity() const noexcept
+        {
+            size_t nCapacity = 0;
+            for (const Block& block : m_vBlocks)
+            {
+                nCapacity += block.nSize;
+            }
+            return nCapacity;
+        }
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<char[]> pData;
+            size_t nSize;
+        };
+
+        /**
+        * @brief        nMinSize 이상 남은 다음 블록으로 이동 (Reset 후 남아 있는 블록을 우선 재사용)
+        */
+        void NextBlock(size_t nMinSize)
+        {
+            size_t nNext = m_pCur == nullptr ? 0 : m_nBlockIndex + 1;
+            while (nNext < m_vBlocks.size() &&
+                m_vBlocks[nNext].nSize < nMinSize)
+            {
+                ++nNext;
+            }
+            if (nNext >= m_vBlocks.size())
+            {
+                const size_t nSize = nMinSize > m_nBlockSize ? nMinSize : m_nBlockSize;
+                m_vBlocks.push_back(Block{ std::make_unique_for_overwrite<char[]>(nSize), nSize });
+                nNext = m_vBlocks.size() - 1;
+            }
+
+            m_nBlockIndex = nNext;
+            m_pCur = m_vBlocks[nNext].pData.get();
+            m_pEnd = m_pCur + m_vBlocks[nNext].nSize;
+        }
+
+        std::vector<Block> m_vBlocks;
+        size_t m_nBlockSize = DEFAULT_BLOCK_SIZE;
+        size_t m_nBlockIndex = 0;
+        char* m_pCur = nullptr;
+        char* m_pEnd = nullptr;
+        size_t m_nUsedSize = 0;
+    };
+
+    /**
+    * @brief        현재 스레드 전용 아레나 (잠금 없음, 스레드 종료 시 해제)
+    */
+    inline StringArena& GetThreadArena()
+    {
+        thread_local StringArena arena;
+        return arena;
+    }
+
+    /**
+    * @brief        같은 문자열을 한 벌만 보관하는 인터닝 테이블
+    * @details      문자열 본문은 내부 StringArena에 복사되며, 같은 내용이면 항상 같은 포인터의 string_view를 돌려준다.
+    *               (따라서 인터닝된 문자열끼리는 data() 포인터 비교로 동등 비교 가능)
+    *               색인은 해시값을 함께 저장하는 open addressing 테이블 (선형 탐사, 적재율 1/2 이하)
+    *               스레드 안전하지 않음
+    */
+    class StringInterner
+    {
+    public:
+        explicit StringInterner(size_t nBlockSize = StringArena::DEFAULT_BLOCK_SIZE)
+            : m_arena(nBlockSize)
+        {
+        }
+
+        /**
+        * @brief        문자열을 인터닝하는 함수
+        * @return       보관된 문자열 (Clear() 전까지 유효)
+        */
+        std::string_view Intern(std::string_view svText)
+        {
+            if ((m_nCount + 1) * 2 > m_vSlots.size())
+            {
+                Grow();
+            }
+
+            const uint64_t nHash = HashString(svText);
+            const size_t nMask = m_vSlots.size() - 1;
+            size_t nIdx = static_cast<size_t>(nHash) & nMask;
+            while (m_vSlots[nIdx].pData != nullptr)
+            {
+                const Slot& slot = m_vSlots[nIdx];
+                if (slot.nHash == nHash &&
+                    std::string_view(slot.pData, slot.nSize) == svText)
+                {
+                    return std::string_view(slot.pData, slot.nSize);
+                }
+                nIdx = (nIdx + 1) & nMask;
+            }
+
+            std::string_view svCopy = m_arena.Copy(svText);
+            m_vSlots[nIdx] = Slot{ nHash, svCopy.data(), svCopy.size() };
+            ++m_nCount;
+            return svCopy;
+        }
+
+        /**
+        * @brief        인터닝된 문자열을 찾는 함수 (없으면 빈 string_view, data() == nullptr)
+        */
+        std::string_view Find(std::string_view svText) const noexcept
+        {
+            if (m_vSlots.empty())
+            {
+                return std::string_view();
+            }
+
+            const uint64_t nHash = HashString(svText);
+            const size_t nMask = m_vSlots.size() - 1;
+            for (size_t nIdx = static_cast<size_t>(nHash) & nMask; m_vSlots[nIdx].pData != nullptr; nIdx = (nIdx + 1) & nMask)
+            {
+                const Slot& slot = m_vSlots[nIdx];
+                if (slot.nHash == nHash &&
+                    std::string_view(slot.pData, slot.nSize) == svText)
+                {
+                    return std::string_view(slot.pData, slot.nSize);
+                }
+            }
+            return std::string_view();
+        }
+
+        size_t GetCount() const noexcept
+        {
+            return m_nCount;
+        }
+
+        /**
+        * @brief        모든 문자열을 비움 (아레나 블록과 테이블 용량은 유지)
+        */
+        void Clear() noexcept
+        {
+            std::fill(m_vSlots.begin(), m_vSlots.end(), Slot{});
+            m_nCount = 0;
+            m_arena.Reset();
+        }
+
+    private:
+        struct Slot
+        {
+            uint64_t nHash = 0;
+            const char* pData = nullptr;
+            size_t nSize = 0;
+        };
+
+        void Grow()
+        {
+            std::vector<Slot> vOld = std::move(m_vSlots);
+            m_vSlots.assign(vOld.empty() ? 64 : vOld.size() * 2, Slot{});
+            const size_t nMask = m_vSlots.size() - 1;
+            for (const Slot& slot : vOld)
+            {
+                if (slot.pData == nullptr)
+                {
+                    continue;
+                }
+                size_t nIdx = static_cast<size_t>(slot.nHash) & nMask;
+                while (m_vSlots[nIdx].pData != nullptr)
+                {
+                    nIdx = (nIdx + 1) & nMask;
+                }
+                m_vSlots[nIdx] = slot;
+            }
+        }
+
+        StringArena m_arena;
+        std::vector<Slot> m_vSlots;
+        size_t m_nCount = 0;
+    };
+    namespace detail
+    {
+        inline char ToLowerAscii(char ch) noexcept
+        {
+            return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+        }
+
+        inline bool IsSpace(char ch) noexcept
+        {
+            return ch == ' ' || (ch >= '\t' && ch <= '\r');
+        }
+
+#if defined(ESK_SIMD_AVX2)
+        inline __m256i ToLowerAscii(__m256i vData) noexcept
+        {
+            // 'A'~'Z'만 0x20을 더함 (부호 있는 비교라 0x80 이상 바이트는 그대로)
+            const __m256i vUpper = _mm256_and_si256(
+                _mm256_cmpgt_epi8(vData, _mm256_set1_epi8('A' - 1)),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), vData));
+            return _mm256_or_si256(vData, _mm256_and_si256(vUpper, _mm256_set1_epi8(0x20)));
+        }
+#elif defined(ESK_SIMD_NEON)
+        inline uint8x16_t ToLowerAscii(uint8x16_t vData) noexcept
+        {
+            const uint8x16_t vUpper = vcltq_u8(vsubq_u8(vData, vdupq_n_u8('A')), vdupq_n_u8(26));
+            return vorrq_u8(vData, vandq_u8(vUpper, vdupq_n_u8(0x20)));
+        }
+
+        /**
+        * @brief        비교 결과를 바이트당 4비트 마스크로 줄인 값 (countr_zero >> 2 가 바이트 위치)
+        */
+        inline uint64_t MoveMask(uint8x16_t vEqual) noexcept
+        {
+            return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vEqual), 4)), 0);
+        }
+#endif
+
+        /**
+        * @brief        구분자 문자 집합 (256비트 표, SIMD 경로는 구분자 8개 이하일 때만 사용)
+        */
+        class DelimiterSet
+        {
+        public:
+            static constexpr size_t MAX_SIMD_DELIMS = 8;
+
+            explicit DelimiterSet(std::string_view svDelims) noexcept
+                : m_svDelims(svDelims)
+            {
+                for (char ch : svDelims)
+                {
+                    const uint8_t nByte = static_cast<uint8_t>(ch);
+                    m_arrBits[nByte >> 6] |= 1ull << (nByte & 63);
+                }
+            }
+
+            bool Contains(char ch) const noexcept
+            {
+                const uint8_t nByte = static_cast<uint8_t>(ch);
+                return (m_arrBits[nByte >> 6] >> (nByte & 63)) & 1;
+            }
+
+            bool IsSIMD() const noexcept
+            {
+                return !m_svDelims.empty() && m_svDelims.size() <= MAX_SIMD_DELIMS;
+            }
+
+#if defined(ESK_SIMD_AVX2)
+            static constexpr size_t SIMD_WIDTH = 32;
+
+            /**
+            * @brief        pData부터 32바이트 중 구분자 위치 비트 마스크
+            */
+            uint64_t MatchMask(const char* pData) const noexcept
+            {
+                const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
+                __m256i vMatch = _mm256_setzero_si256();
+                for (char ch : m_svDelims)
+                {
+                    vMatch = _mm256_or_si256(vMatch, _mm256_cmpeq_epi8(vData, _mm256_set1_epi8(ch)));
+                }
+                return static_cast<uint32_t>(_mm256_movemask_epi8(vMatch));
+            }
+#elif defined(ESK_SIMD_NEON)
+            static constexpr size_t SIMD_WIDTH = 16;
+
+            /**
+            * @brief        pData부터 16바이트 중 구분자 위치 마스크 (바이트당 4비트)
+            */
+            uint64_t MatchMask(const char* pData) const noexcept
+            {
+                const uint8x16_t vData = vld1q_u8(reinterpret_cast<const uint8_t*>(pData));
+                uint8x16_t vMatch = vdupq_n_u8(0);
+                for (char ch : m_svDelims)
+                {
+                    vMatch = vorrq_u8(vMatch, vceqq_u8(vData, vdupq_n_u8(static_cast<uint8_t>(ch))));
+                }
+                return MoveMask(vMatch) & 0x8888888888888888ull;
+            }
+#endif
+
+        private:
+            uint64_t m_arrBits[4]{};
+            std::string_view m_svDelims;
+        };
+    } // namespace detail
+
+    /**
+    * @brief        앞쪽 공백(' ', \t, \r, \n, \v, \f) 제거
+    */
+    inline std::string_view TrimLeft(std::string_view svText) noexcept
+    {
+        size_t nBegin = 0;
+        while (nBegin < svText.size() &&
+            detail::IsSpace(svText[nBegin]))
+        {
+            ++nBegin;
+        }
+        return svText.substr(nBegin);
+    }
+
+    /**
+    * @brief        뒤쪽 공백(' ', \t, \r, \n, \v, \f) 제거
+    */
+    inline std::string_view TrimRight(std::string_view svText) noexcept
+    {
+        size_t nEnd = svText.size();
+        while (nEnd > 0 &&
+            detail::IsSpace(svText[nEnd - 1]))
+        {
+            --nEnd;
+        }
+        return svText.substr(0, nEnd);
+    }
+
+    /**
+    * @brief        앞뒤 공백 제거
+    */
+    inline std::string_view Trim(std::string_view svText) noexcept
+    {
+        return TrimRight(TrimLeft(svText));
+    }
+
+    /**
+    * @brief        구분자 집합의 문자 중 하나라도 만나면 나누는 함수 (할당 없음, 결과는 원본을 가리킴)
+    * @details      구분자가 8개 이하면 SIMD로 블록마다 구분자 위치 마스크를 구해 한 번에 처리
+    * @param[in]    svText          원본 문자열
+    * @param[in]    svDelims        구분자 문자 집합 (예: " ,;\t")
+    * @param[out]   pOut            결과를 받을 배열
+    * @param[in]    nMaxCount       pOut 배열 크기 (가득 차면 마지막 원소에 나머지 전체가 들어감, bIsSkipEmpty면 나머지 앞의 구분자는 제외)
+    * @param[in]    bIsSkipEmpty    빈 토큰(연속 구분자, 앞뒤 구분자) 제외 여부
+    * @return       pOut에 쓴 개수
+    */
+    inline size_t Split(std::string_view svText, std::string_view svDelims, std::string_view* pOut, size_t nMaxCount, bool bIsSkipEmpty = false) noexcept
+    {
+        if (pOut == nullptr ||
+            nMaxCount == 0)
+        {
+            return 0;
+        }
+
+        const char* pData = svText.data();
+        const size_t nSize = svText.size();
+        const detail::DelimiterSet delims(svDelims);
+        size_t nCount = 0;
+        size_t nStart = 0;
+        bool bIsFull = nMaxCount == 1;
+
+        // 토큰 하나를 쓰고 마지막 칸만 남으면 true
+        auto Emit = [&](size_t nEnd) noexcept
+            {
+                if (!bIsSkipEmpty ||
+                    nEnd > nStart)
+                {
+                    pOut[nCount++] = std::string_view(pData + nStart, nEnd - nStart);
+                }
+                nStart = nEnd + 1;
+                return nCount + 1 >= nMaxCount;
+            };
+
+        size_t nIdx = 0;
+#if defined(ESK_SIMD_AVX2) || defined(ESK_SIMD_NEON)
+        if (delims.IsSIMD())
+        {
+            constexpr size_t SHIFT = detail::DelimiterSet::SIMD_WIDTH == 16 ? 2 : 0;
+            for (; !bIsFull && nIdx + detail::DelimiterSet::SIMD_WIDTH <= nSize; nIdx += detail::DelimiterSet::SIMD_WIDTH)
+            {
+                uint64_t nMask = delims.MatchMask(pData + nIdx);
+                while (nMask != 0 &&
+                    !bIsFull)
+                {
+                    bIsFull = Emit(nIdx + (std::countr_zero(nMask) >> SHIFT));
+                    nMask &= nMask - 1;
+                }
+            }
+        }
+#endif
+        for (; !bIsFull && nIdx < nSize; ++nIdx)
+        {
+            if (delims.Contains(pData[nIdx]))
+            {
+                bIsFull = Emit(nIdx);
+            }
+        }
+
+        // 가득 차서 멈춘 경우 나머지 앞의 빈 토큰(연속 구분자)도 건너뜀
+        if (bIsSkipEmpty)
+        {
+            while (nStart < nSize &&
+                delims.Contains(pData[nStart]))
+            {
+                ++nStart;
+            }
+        }
+        if (!bIsSkipEmpty ||
+            nStart < nSize)
+        {
+            pOut[nCount++] = std::string_view(pData + nStart, nSize - nStart);
+        }
+        return nCount;
+    }
+
+    /**
+    * @brief        부분 문자열 검색 (std::string_view::find와 동일한 결과)
+    * @details      SIMD 경로는 패턴의 첫 글자와 마지막 글자가 동시에 맞는 위치만 골라 나머지를 비교
+    *               (블록당 후보가 드물어 일반 텍스트에서 선형 시간에 가깝다. 최악의 경우 O(n*m))
+    * @param[in]    svText          검색 대상
+    * @param[in]    svPattern       찾을 문자열
+    * @param[in]    nPos            검색 시작 위치
+    * @return       찾은 위치 (없으면 std::string_view::npos)
+    */
+    inline size_t Find(std::string_view svText, std::string_view svPattern, size_t nPos = 0) noexcept
+    {
+        const size_t nSize = svText.size();
+        const size_t nPatternSize = svPattern.size();
+        if (nPos > nSize ||
+            nSize - nPos < nPatternSize)
+        {
+            return std::string_view::npos;
+        }
+        if (nPatternSize <= 1)
+        {
+            return nPatternSize == 0 ? nPos : svText.find(svPattern[0], nPos);
+        }
+
+        size_t nIdx = nPos;
+#if defined(ESK_SIMD_AVX2) || defined(ESK_SIMD_NEON)
+        const char* pData = svText.data();
+        const char* pPattern = svPattern.data();
+        const size_t nLast = nPatternSize - 1;
+#endif
+#if defined(ESK_SIMD_AVX2)
+        const __m256i vFirst = _mm256_set1_epi8(pPattern[0]);
+        const __m256i vLast = _mm256_set1_epi8(pPattern[nLast]);
+        for (; nIdx + nLast + 32 <= nSize; nIdx += 32)
+        {
+            const __m256i vHead = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + nIdx));
+            const __m256i vTail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + nIdx + nLast));
+            uint32_t nMask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(vHead, vFirst), _mm256_cmpeq_epi8(vTail, vLast))));
+            while (nMask != 0)
+            {
+                const size_t nCandidate = nIdx + std::countr_zero(nMask);
+                if (::memcmp(pData + nCandidate + 1, pPattern + 1, nLast - 1) == 0)
+                {
+                    return nCandidate;
+                }
+                nMask &= nMask - 1;
+            }
+        }
+#elif defined(ESK_SIMD_NEON)
+        const uint8x16_t vFirst = vdupq_n_u8(static_cast<uint8_t>(pPattern[0]));
+        const uint8x16_t vLast = vdupq_n_u8(static_cast<uint8_t>(pPattern[nLast]));
+        for (; nIdx + nLast + 16 <= nSize; nIdx += 16)
+        {
+            const uint8x16_t vHead = vld1q_u8(reinterpret_cast<const uint8_t*>(pData + nIdx));
+            const uint8x16_t vTail = vld1q_u8(reinterpret_cast<const uint8_t*>(pData + nIdx + nLast));
+            uint64_t nMask = detail::MoveMask(vandq_u8(vceqq_u8(vHead, vFirst), vceqq_u8(vTail, vLast))) & 0x8888888888888888ull;
+            while (nMask != 0)
+            {
+                const size_t nCandidate = nIdx + (std::countr_zero(nMask) >> 2);
+                if (::memcmp(pData + nCandidate + 1, pPattern + 1, nLast - 1) == 0)
+                {
+                    return nCandidate;
+                }
+                nMask &= nMask - 1;
+            }
+        }
+#endif
+        return svText.find(svPattern, nIdx);
+    }
+
+    /**
+    * @brief        대소문자 무시 비교 (ASCII만, strcasecmp와 같은 부호)
+    * @return       svLeft가 작으면 음수, 같으면 0, 크면 양수
+    */
+    inline int CompareNoCase(std::string_view svLeft, std::string_view svRight) noexcept
+    {
+        const size_t nSize = svLeft.size() < svRight.size() ? svLeft.size() : svRight.size();
+        const char* pLeft = svLeft.data();
+        const char* pRight = svRight.data();
+        size_t nIdx = 0;
+#if defined(ESK_SIMD_AVX2)
+        for (; nIdx + 32 <= nSize; nIdx += 32)
+        {
+            const __m256i vLeft = detail::ToLowerAscii(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pLeft + nIdx)));
+            const __m256i vRight = detail::ToLowerAscii(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRight + nIdx)));
+            const uint32_t nDiff = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vLeft, vRight)));
+            if (nDiff != 0)
+            {
+                nIdx += std::countr_zero(nDiff);
+                break;
+            }
+        }
+#elif defined(ESK_SIMD_NEON)
+        for (; nIdx + 16 <= nSize; nIdx += 16)
+        {
+            const uint8x16_t vLeft = detail::ToLowerAscii(vld1q_u8(reinterpret_cast<const uint8_t*>(pLeft + nIdx)));
+            const uint8x16_t vRight = detail::ToLowerAscii(vld1q_u8(reinterpret_cast<const uint8_t*>(pRight + nIdx)));
+            const uint64_t nDiff = ~detail::MoveMask(vceqq_u8(vLeft, vRight));
+            if (nDiff != 0)
+            {
+                nIdx += std::countr_zero(nDiff) >> 2;
+                break;
+            }
+        }
+#endif
+        for (; nIdx < nSize; ++nIdx)
+        {
+            const uint8_t nLeft = static_cast<uint8_t>(detail::ToLowerAscii(pLeft[nIdx]));
+            const uint8_t nRight = static_cast<uint8_t>(detail::ToLowerAscii(pRight[nIdx]));
+            if (nLeft != nRight)
+            {
+                return nLeft < nRight ? -1 : 1;
+            }
+        }
+
+        if (svLeft.size() == svRight.size())
+        {
+            return 0;
+        }
+        return svLeft.size() < svRight.size() ? -1 : 1;
+    }
+
+    /**
+    * @brief        대소문자 무시 동등 비교 (ASCII만)
+    */
+    inline bool IsEqualNoCase(std::string_view svLeft, std::string_view svRight) noexcept
+    {
+        return svLeft.size() == svRight.size() &&
+            CompareNoCase(svLeft, svRight) == 0;
+    }
+
+    /**
+    * @brief        대소문자 무시 부분 문자열 검색 (ASCII만, 방식은 Find와 동일)
+    * @return       찾은 위치 (없으면 std::string_view::npos)
+    */
+    inline size_t FindNoCase(std::string_view svText, std::string_view svPattern, size_t nPos = 0) noexcept
+    {
+        const size_t nSize = svText.size();
+        const size_t nPatternSize = svPattern.size();
+        if (nPos > nSize ||
+            nSize - nPos < nPatternSize)
+        {
+            return std::string_view::npos;
+        }
+        if (nPatternSize == 0)
+        {
+            return nPos;
+        }
+
+        const char* pData = svText.data();
+        const size_t nLast = nPatternSize - 1;
+        const char chFirst = detail::ToLowerAscii(svPattern[0]);
+        const char chLast = detail::ToLowerAscii(svPattern[nLast]);
+        size_t nIdx = nPos;
+#if defined(ESK_SIMD_AVX2)
+        const __m256i vFirst = _mm256_set1_epi8(chFirst);
+        const __m256i vLast = _mm256_set1_epi8(chLast);
+        for (; nIdx + nLast + 32 <= nSize; nIdx += 32)
+        {
+            const __m256i vHead = detail::ToLowerAscii(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + nIdx)));
+            const __m256i vTail = detail::ToLowerAscii(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + nIdx + nLast)));
+            uint32_t nMask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(vHead, vFirst), _mm256_cmpeq_epi8(vTail, vLast))));
+            while (nMask != 0)
+            {
+                const size_t nCandidate = nIdx + std::countr_zero(nMask);
+                if (IsEqualNoCase(std::string_view(pData + nCandidate, nPatternSize), svPattern))
+                {
+                    return nCandidate;
+                }
+                nMask &= nMask - 1;
+            }
+        }
+#elif defined(ESK_SIMD_NEON)
+        const uint8x16_t vFirst = vdupq_n_u8(static_cast<uint8_t>(chFirst));
+        const uint8x16_t vLast = vdupq_n_u8(static_cast<uint8_t>(chLast));
+        for (; nIdx + nLast + 16 <= nSize; nIdx += 16)
+        {
+            const uint8x16_t vHead = detail::ToLowerAscii(vld1q_u8(reinterpret_cast<const uint8_t*>(pData + nIdx)));
+            const uint8x16_t vTail = detail::ToLowerAscii(vld1q_u8(reinterpret_cast<const uint8_t*>(pData + nIdx + nLast)));
+            uint64_t nMask = detail::MoveMask(vandq_u8(vceqq_u8(vHead, vFirst), vceqq_u8(vTail, vLast))) & 0x8888888888888888ull;
+            while (nMask != 0)
+            {
+                const size_t nCandidate = nIdx + (std::countr_zero(nMask) >> 2);
+                if (IsEqualNoCase(std::string_view(pData + nCandidate, nPatternSize), svPattern))
+                {
+                    return nCandidate;
+                }
+                nMask &= nMask - 1;
+            }
+        }
+#endif
+        for (; nIdx + nLast < nSize; ++nIdx)
+        {
+            if (detail::ToLowerAscii(pData[nIdx]) == chFirst &&
+                detail::ToLowerAscii(pData[nIdx + nLast]) == chLast &&
+                IsEqualNoCase(std::string_view(pData + nIdx, nPatternSize), svPattern))
+            {
+                return nIdx;
+            }
+        }
+        return std::string_view::npos;
+    }
+    /**
+    * @brief        힙을 쓰지 않는 고정 용량 문자열 (최대 N 글자)
+    * @details      trivially copyable / standard layout이라 memcpy, 공유 메모리, 해시 맵 키로 그대로 사용 가능
+    *               (포인터를 갖지 않으며 컴파일러/표준 라이브러리와 관계없이 레이아웃이 같다)
+    *               저장 공간은 8바이트 배수로 잡고 길이 이후는 항상 0으로 채워 두어 비교를 워드 단위로 한다.
+    *               constexpr 생성 가능 (리터럴 용량 초과는 컴파일 에러)
+    */
+    template <size_t N>
+    class FixedString
+    {
+    public:
+        static_assert(N > 0 && N < UINT32_MAX, "FixedString capacity must be in [1, UINT32_MAX)");
+
+        static constexpr size_t CAPACITY = N;
+        static constexpr size_t STORAGE_SIZE = (N + 1 + 7) & ~static_cast<size_t>(7);
+        static constexpr size_t WORD_COUNT = STORAGE_SIZE / sizeof(uint64_t);
+
+        constexpr FixedString() noexcept = default;
+
+        /**
+        * @brief        문자열 리터럴/char 배열 생성자 (첫 '\0' 전까지, 최대 M - 1 글자, 배열 크기가 용량을 넘으면 컴파일 에러)
+        */
+        template <size_t M>
+        constexpr FixedString(const char(&arrText)[M]) noexcept
+        {
+            static_assert(M - 1 <= N, "FixedString capacity exceeded");
+            CopyFrom(arrText, GetArrayLength(arrText));
+        }
+
+        /**
+        * @brief        string_view 생성자
+        * @exception    std::invalid_argument   길이가 용량을 넘는 경우
+        */
+        constexpr explicit FixedString(std::string_view svText)
+        {
+            if (svText.size() > N)
+            {
+                throw std::invalid_argument("FixedString capacity exceeded");
+            }
+            CopyFrom(svText.data(), svText.size());
+        }
+
+        /**
+        * @brief        문자열 교체 (용량 초과면 false, 기존 값 유지)
+        */
+        constexpr bool Assign(std::string_view svText) noexcept
+        {
+            if (svText.size() > N)
+            {
+                return false;
+            }
+            const size_t nOldSize = m_nSize;
+            CopyFrom(svText.data(), svText.size());
+            for (size_t i = svText.size(); i < nOldSize; ++i)
+            {
+                m_arrData[i] = '\0';
+            }
+            return true;
+        }
+
+        /**
+        * @brief        문자열 덧붙이기 (용량 초과면 false, 기존 값 유지)
+        */
+        constexpr bool Append(std::string_view svText) noexcept
+        {
+            if (svText.size() > N - m_nSize)
+            {
+                return false;
+            }
+            for (size_t i = 0; i < svText.size(); ++i)
+            {
+                m_arrData[m_nSize + i] = svText[i];
+            }
+            m_nSize += static_cast<uint32_t>(svText.size());
+            return true;
+        }
+
+        constexpr void Clear() noexcept
+        {
+            for (size_t i = 0; i < m_nSize; ++i)
+            {
+                m_arrData[i] = '\0';
+            }
+            m_nSize = 0;
+        }
+
+        constexpr size_t GetSize() const noexcept
+        {
+            return m_nSize;
+        }
+
+        constexpr bool IsEmpty() const noexcept
+        {
+            return m_nSize == 0;
+        }
+
+        static constexpr size_t GetCapacity() noexcept
+        {
+            return N;
+        }
+
+        constexpr const char* GetCString() const noexcept
+        {
+            return m_arrData;
+        }
+
+        constexpr std::string_view GetView() const noexcept
+        {
+            return std::string_view(m_arrData, m_nSize);
+        }
+
+        constexpr operator std::string_view() const noexcept
+        {
+            return GetView();
+        }
+
+        constexpr char operator[](size_t nIdx) const noexcept
+        {
+            return m_arrData[nIdx];
+        }
+
+        /**
+        * @brief        동등 비교 (저장 공간 전체를 워드 단위로 비교)
+        */
+        constexpr bool operator==(const FixedString& other) const noexcept
+        {
+            if (m_nSize != other.m_nSize)
+            {
+                return false;
+            }
+            if (std::is_constant_evaluated())
+            {
+                return GetView() == other.GetView();
+            }
+            uint64_t nDiff = 0;
+            for (size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                nDiff |= LoadWord(i) ^ other.LoadWord(i);
+            }
+            return nDiff == 0;
+        }
+
+        constexpr bool operator==(std::string_view svText) const noexcept
+        {
+            return GetView() == svText;
+        }
+
+        /**
+        * @brief        문자열 리터럴/char 배열과 비교 (리터럴 생성자와 string_view 비교가 모두 후보가 되어 모호해지는 것을 막음)
+        */
+        template <size_t M>
+        constexpr bool operator==(const char(&arrText)[M]) const noexcept
+        {
+            return GetView() == std::string_view(arrText, GetArrayLength(arrText));
+        }
+
+        /**
+        * @brief        사전식 비교 (부호 없는 바이트 기준, 첫 번째로 다른 워드 안에서 다른 바이트를 찾음)
+        */
+        constexpr std::strong_ordering operator<=>(const FixedString& other) const noexcept
+        {
+            if (std::is_constant_evaluated())
+            {
+                return GetView().compare(other.GetView()) <=> 0;
+            }
+
+            const size_t nMinSize = m_nSize < other.m_nSize ? m_nSize : other.m_nSize;
+            for (size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                const uint64_t nDiff = LoadWord(i) ^ other.LoadWord(i);
+                if (nDiff == 0)
+                {
+                    continue;
+                }
+
+                const size_t nByte = i * sizeof(uint64_t) + (std::endian::native == std::endian::little ?
+                    std::countr_zero(nDiff) : std::countl_zero(nDiff)) / 8;
+                if (nByte >= nMinSize)
+                {
+                    break;
+                }
+                return static_cast<uint8_t>(m_arrData[nByte]) <=> static_cast<uint8_t>(other.m_arrData[nByte]);
+            }
+            return m_nSize <=> other.m_nSize;
+        }
+
+        constexpr std::strong_ordering operator<=>(std::string_view svText) const noexcept
+        {
+            return GetView().compare(svText) <=> 0;
+        }
+
+        template <size_t M>
+        constexpr std::strong_ordering operator<=>(const char(&arrText)[M]) const noexcept
+        {
+            return GetView().compare(std::string_view(arrText, GetArrayLength(arrText))) <=> 0;
+        }
+
+    private:
+        /**
+        * @brief        배열 안 첫 '\0'까지의 길이 (리터럴이 아닌 버퍼는 뒤쪽이 '\0'으로 채워져 있으므로 M - 1로 볼 수 없음)
+        */
+        template <size_t M>
+        static constexpr size_t GetArrayLength(const char(&arrText)[M]) noexcept
+        {
+            size_t nLength = 0;
+            while (nLength < M - 1 &&
+                arrText[nLength] != '\0')
+            {
+                ++nLength;
+            }
+            return nLength;
+        }
+
+        constexpr void CopyFrom(const char* pText, size_t nSize) noexcept
+        {
+            for (size_t i = 0; i < nSize; ++i)
+            {
+                m_arrData[i] = pText[i];
+            }
+            m_nSize = static_cast<uint32_t>(nSize);
+        }
+
+        uint64_t LoadWord(size_t nIdx) const noexcept
+        {
+            uint64_t nWord;
+            ::memcpy(&nWord, m_arrData + nIdx * sizeof(uint64_t), sizeof(uint64_t));
+            return nWord;
+        }
+
+        char m_arrData[STORAGE_SIZE]{};
+        uint32_t m_nSize = 0;
+    };
+    namespace detail
+    {
+        using util::detail::OpenFile;
+
+        /**
+        * @brief        첫 번째 비ASCII 바이트 위치 (없으면 nSize)
+        */
+        inline size_t FindNonAscii(const uint8_t* pData, size_t nSize) noexcept
+        {
+            size_t nIdx = 0;
+#if defined(ESK_SIMD_AVX2)
+            for (; nIdx + 32 <= nSize; nIdx += 32)
+            {
+                const uint32_t nMask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + nIdx))));
+                if (nMask != 0)
+                {
+                    return nIdx + std::countr_zero(nMask);
+                }
+            }
+#elif defined(ESK_SIMD_NEON)
+            for (; nIdx + 16 <= nSize; nIdx += 16)
+            {
+                if (vmaxvq_u8(vld1q_u8(pData + nIdx)) >= 0x80)
+                {
+                    break;
+                }
+            }
+#endif
+            for (; nIdx + 8 <= nSize; nIdx += 8)
+            {
+                uint64_t nWord = 0;
+                ::memcpy(&nWord, pData + nIdx, sizeof(uint64_t));
+                if ((nWord & 0x8080808080808080ull) != 0)
+                {
+                    break;
+                }
+            }
+            while (nIdx < nSize &&
+                pData[nIdx] < 0x80)
+            {
+                ++nIdx;
+            }
+            return nIdx;
+        }
+
+        /**
+        * @brief        UTF-8 한 글자 디코딩 (과잉 표현, 서로게이트, U+10FFFF 초과를 모두 거부)
+        * @return       소비한 바이트 수 (잘못되었거나 잘린 시퀀스면 0)
+        */
+        inline size_t DecodeUTF8(const uint8_t* pSrc, size_t nRemain, char32_t* pOutCode) noexcept
+        {
+            const uint8_t nLead = pSrc[0];
+            if (nLead < 0x80)
+            {
+                *pOutCode = nLead;
+                return 1;
+            }
+            if (nLead < 0xC2)
+            {
+                return 0;
+            }
+            if (nLead < 0xE0)
+            {
+                if (nRemain < 2 ||
+                    (pSrc[1] & 0xC0) != 0x80)
+                {
+                    return 0;
+                }
+                *pOutCode = (static_cast<char32_t>(nLead & 0x1F) << 6) | (pSrc[1] & 0x3F);
+                return 2;
+            }
+            if (nLead < 0xF0)
+            {
+                if (nRemain < 3 ||
+                    (pSrc[1] & 0xC0) != 0x80 ||
+                    (pSrc[2] & 0xC0) != 0x80)
+                {
+                    return 0;
+                }
+                const char32_t nCode = (static_cast<char32_t>(nLead & 0x0F) << 12) | (static_cast<char32_t>(pSrc[1] & 0x3F) << 6) | (pSrc[2] & 0x3F);
+                if (nCode < 0x800 ||
+                    (nCode >= 0xD800 && nCode <= 0xDFFF))
+                {
+                    return 0;
+                }
+                *pOutCode = nCode;
+                return 3;
+            }
+            if (nLead < 0xF5)
+            {
+                if (nRemain < 4 ||
+                    (pSrc[1] & 0xC0) != 0x80 ||
+                    (pSrc[2] & 0xC0) != 0x80 ||
+                    (pSrc[3] & 0xC0) != 0x80)
+                {
+                    return 0;
+                }
+                const char32_t nCode = (static_cast<char32_t>(nLead & 0x07) << 18) | (static_cast<char32_t>(pSrc[1] & 0x3F) << 12) |
+                    (static_cast<char32_t>(pSrc[2] & 0x3F) << 6) | (pSrc[3] & 0x3F);
+                if (nCode < 0x10000 ||
+                    nCode > 0x10FFFF)
+                {
+                    return 0;
+                }
+                *pOutCode = nCode;
+                return 4;
+            }
+            return 0;
+        }
+
+        /**
+        * @brief        유효한 코드 포인트를 UTF-8로 인코딩
+        * @return       쓴 바이트 수
+        */
+        inline size_t EncodeUTF8(char32_t nCode, char* pDst) noexcept
+        {
+            if (nCode < 0x80)
+            {
+                pDst[0] = static_cast<char>(nCode);
+                return 1;
+            }
+            if (nCode < 0x800)
+            {
+                pDst[0] = static_cast<char>(0xC0 | (nCode >> 6));
+                pDst[1] = static_cast<char>(0x80 | (nCode & 0x3F));
+                return 2;
+            }
+            if (nCode < 0x10000)
+            {
+                pDst[0] = static_cast<char>(0xE0 | (nCode >> 12));
+                pDst[1] = static_cast<char>(0x80 | ((nCode >> 6) & 0x3F));
+                pDst[2] = static_cast<char>(0x80 | (nCode & 0x3F));
+                return 3;
+            }
+            pDst[0] = static_cast<char>(0xF0 | (nCode >> 18));
+            pDst[1] = static_cast<char>(0x80 | ((nCode >> 12) & 0x3F));
+            pDst[2] = static_cast<char>(0x80 | ((nCode >> 6) & 0x3F));
+            pDst[3] = static_cast<char>(0x80 | (nCode & 0x3F));
+            return 4;
+        }
+
+        inline size_t GetUTF8Length(char32_t nCode) noexcept
+        {
+            return nCode < 0x80 ? 1 : nCode < 0x800 ? 2 : nCode < 0x10000 ? 3 : 4;
+        }
+
+        /**
+        * @brief        끝에서 잘린 UTF-8 시퀀스를 제외한 길이 (청크 단위 검증에서 경계를 맞추기 위함)
+        */
+        inline size_t GetCompleteUTF8Size(const uint8_t* pData, size_t nSize) noexcept
+        {
+            for (size_t k = 1; k <= 3 && k <= nSize; ++k)
+            {
+                const uint8_t nByte = pData[nSize - k];
+                if ((nByte & 0xC0) == 0x80)
+                {
+                    continue;
+                }
+                const size_t nLength = nByte >= 0xF0 ? 4 : nByte >= 0xE0 ? 3 : nByte >= 0xC0 ? 2 : 1;
+                return nLength > k ? nSize - k : nSize;
+            }
+            return nSize;
+        }
+
+        inline bool IsValidUTF8Scalar(const uint8_t* pData, size_t nSize) noexcept
+        {
+            size_t nIdx = 0;
+            while (nIdx < nSize)
+            {
+                nIdx += FindNonAscii(pData + nIdx, nSize - nIdx);
+                if (nIdx >= nSize)
+                {
+                    break;
+                }
+
+                char32_t nCode = 0;
+                const size_t nLength = DecodeUTF8(pData + nIdx, nSize - nIdx, &nCode);
+                if (nLength == 0)
+                {
+                    return false;
+                }
+                nIdx += nLength;
+            }
+            return true;
+        }
+
+#if defined(ESK_SIMD_AVX2)
+        /**
+        * @brief        AVX2 UTF-8 검증 (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte")
+        * @details      앞 바이트의 상/하위 니블과 현재 바이트의 상위 니블로 표 3개를 찾아 AND 하면 2바이트 단위 오류가 남고,
+        *               3/4바이트 시퀀스의 연속 바이트 개수는 2, 3바이트 앞의 선두 바이트로 따로 확인한다.
+        *               32바이트 블록 전체가 ASCII면 직전 블록이 잘린 시퀀스로 끝났는지만 본다.
+        */
+        inline bool IsValidUTF8AVX2(const uint8_t* pData, size_t nSize) noexcept
+        {
+            constexpr uint8_t TOO_SHORT = 1 << 0;
+            constexpr uint8_t TOO_LONG = 1 << 1;
+            constexpr uint8_t OVERLONG_3 = 1 << 2;
+            constexpr uint8_t TOO_LARGE = 1 << 3;
+            constexpr uint8_t SURROGATE = 1 << 4;
+            constexpr uint8_t OVERLONG_2 = 1 << 5;
+            constexpr uint8_t TOO_LARGE_1000 = 1 << 6;
+            constexpr uint8_t OVERLONG_4 = 1 << 6;
+            constexpr uint8_t TWO_CONTS = 1 << 7;
+            constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+            const __m256i vByte1High = _mm256_setr_epi8(
+                TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+                static_cast<char>(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4),
+                TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+                static_cast<char>(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4));
+            const __m256i vByte1Low = _mm256_setr_epi8(
+                static_cast<char>(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4), static_cast<char>(CARRY | OVERLONG_2), static_cast<char>(CARRY), static_cast<char>(CARRY),
+                static_cast<char>(CARRY | TOO_LARGE), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                static_cast<char>(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4), static_cast<char>(CARRY | OVERLONG_2), static_cast<char>(CARRY), static_cast<char>(CARRY),
+                static_cast<char>(CARRY | TOO_LARGE), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000), static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000));
+            const __m256i vByte2High = _mm256_setr_epi8(
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4),
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4),
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+                static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+            // 마지막 3바이트가 각각 이 값보다 크면 다음 블록으로 이어지는 시퀀스
+            const __m256i vMaxValue = _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+            const __m256i vNibble = _mm256_set1_epi8(0x0F);
+
+            __m256i vError = _mm256_setzero_si256();
+            __m256i vPrevInput = _mm256_setzero_si256();
+            __m256i vPrevIncomplete = _mm256_setzero_si256();
+
+            auto CheckBlock = [&](__m256i vInput) noexcept
+                {
+                    if (_mm256_movemask_epi8(vInput) == 0)
+                    {
+                        vError = _mm256_or_si256(vError, vPrevIncomplete);
+                    }
+                    else
+                    {
+                        // 직전 블록과 이어 붙여 1, 2, 3바이트 앞의 바이트를 만든다.
+                        const __m256i vJoined = _mm256_permute2x128_si256(vPrevInput, vInput, 0x21);
+                        const __m256i vPrev1 = _mm256_alignr_epi8(vInput, vJoined, 16 - 1);
+                        const __m256i vPrev2 = _mm256_alignr_epi8(vInput, vJoined, 16 - 2);
+                        const __m256i vPrev3 = _mm256_alignr_epi8(vInput, vJoined, 16 - 3);
+
+                        const __m256i vSpecial = _mm256_and_si256(
+                            _mm256_and_si256(
+                                _mm256_shuffle_epi8(vByte1High, _mm256_and_si256(_mm256_srli_epi16(vPrev1, 4), vNibble)),
+                                _mm256_shuffle_epi8(vByte1Low, _mm256_and_si256(vPrev1, vNibble))),
+                            _mm256_shuffle_epi8(vByte2High, _mm256_and_si256(_mm256_srli_epi16(vInput, 4), vNibble)));
+
+                        // 2바이트 앞이 111_____ 또는 3바이트 앞이 1111____ 이면 연속 바이트여야 함
+                        const __m256i vMust23 = _mm256_or_si256(
+                            _mm256_subs_epu8(vPrev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                            _mm256_subs_epu8(vPrev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+                        const __m256i vMust23_80 = _mm256_and_si256(vMust23, _mm256_set1_epi8(static_cast<char>(0x80)));
+
+                        vError = _mm256_or_si256(vError, _mm256_xor_si256(vMust23_80, vSpecial));
+                        vPrevIncomplete = _mm256_subs_epu8(vInput, vMaxValue);
+                    }
+                    vPrevInput = vInput;
+                };
+
+            size_t nIdx = 0;
+            for (; nIdx + 32 <= nSize; nIdx += 32)
+            {
+                CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + nIdx)));
+            }
+            if (nIdx < nSize)
+            {
+                // 0으로 채운 꼬리는 ASCII이므로 잘린 시퀀스는 TOO_SHORT로 잡힌다.
+                alignas(32) uint8_t arrTail[32]{};
+                ::memcpy(arrTail, pData + nIdx, nSize - nIdx);
+                CheckBlock(_mm256_load_si256(reinterpret_cast<const __m256i*>(arrTail)));
+            }
+            vError = _mm256_or_si256(vError, vPrevIncomplete);
+            return _mm256_testz_si256(vError, vError) != 0;
+        }
+#endif
+    } // namespace detail
+
+    /**
+    * @brief        UTF-8 유효성 검사 (과잉 표현, 서로게이트, U+10FFFF 초과, 잘린 시퀀스 모두 오류)
+    * @param[in]    pData           검사할 데이터
+    * @param[in]    nSize           바이트 수
+    * @return       true: 유효한 UTF-8, false: 잘못된 시퀀스 포함
+    */
+    inline bool IsValidUTF8(const char* pData, size_t nSize) noexcept
+    {
+        if (pData == nullptr)
+        {
+            return nSize == 0;
+        }
+#if defined(ESK_SIMD_AVX2)
+        return detail::IsValidUTF8AVX2(reinterpret_cast<const uint8_t*>(pData), nSize);
+#else
+        return detail::IsValidUTF8Scalar(reinterpret_cast<const uint8_t*>(pData), nSize);
+#endif
+    }
+
+    /**
+    * @brief        첫 번째 잘못된 UTF-8 시퀀스의 위치를 찾는 함수
+    * @return       잘못된 시퀀스의 시작 위치 (모두 유효하면 nSize)
+    */
+    inline size_t FindInvalidUTF8(const char* pData, size_t nSize) noexcept
+    {
+        const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pData);
+        size_t nIdx = 0;
+        while (nIdx < nSize)
+        {
+            nIdx += detail::FindNonAscii(pBytes + nIdx, nSize - nIdx);
+            if (nIdx >= nSize)
+            {
+                break;
+            }
+
+            char32_t nCode = 0;
+            const size_t nLength = detail::DecodeUTF8(pBytes + nIdx, nSize - nIdx, &nCode);
+            if (nLength == 0)
+            {
+                return nIdx;
+            }
+            nIdx += nLength;
+        }
+        return nSize;
+    }
+
+    /**
+    * @brief        파일 전체가 유효한 UTF-8인지 검사하는 함수 (1MB 단위로 읽어 검사, 파일 크기와 무관한 메모리 사용)
+    * @param[in]    pszFileName         검사할 파일 경로
+    * @param[out]   pOutErrorOffset     잘못된 시퀀스의 파일 내 위치 (nullptr 가능, 유효하면 파일 크기)
+    * @return       true: 유효한 UTF-8, false: 잘못된 시퀀스 포함 또는 파일 열기 실패
+    */
+    inline bool IsValidUTF8File(const char* pszFileName, size_t* pOutErrorOffset = nullptr)
+    {
+        constexpr size_t CHUNK_SIZE = 1 << 20;
+
+        FILE* pFile = pszFileName == nullptr ? nullptr : detail::OpenFile(pszFileName, "rb");
+        if (pFile == nullptr)
+        {
+            return false;
+        }
+
+        std::vector<char> vBuffer(CHUNK_SIZE + 3);
+        size_t nCarry = 0;
+        size_t nOffset = 0;
+        bool bIsValid = true;
+        for (;;)
+        {
+            const size_t nRead = ::fread(vBuffer.data() + nCarry, 1, CHUNK_SIZE, pFile);
+            const size_t nSize = nCarry + nRead;
+            const bool bIsLast = nRead < CHUNK_SIZE;
+
+            // 청크 끝에서 잘린 시퀀스는 다음 청크 앞으로 넘긴다.
+            const size_t nComplete = bIsLast ? nSize : detail::GetCompleteUTF8Size(reinterpret_cast<const uint8_t*>(vBuffer.data()), nSize);
+            if (!IsValidUTF8(vBuffer.data(), nComplete))
+            {
+                nOffset += FindInvalidUTF8(vBuffer.data(), nComplete);
+                bIsValid = false;
+                break;
+            }
+
+            nOffset += nComplete;
+            nCarry = nSize - nComplete;
+            ::memmove(vBuffer.data(), vBuffer.data() + nComplete, nCarry);
+            if (bIsLast)
+            {
+                break;
+            }
+        }
+        ::fclose(pFile);
+
+        if (pOutErrorOffset != nullptr)
+        {
+            *pOutErrorOffset = nOffset;
+        }
+        return bIsValid;
+    }
+
+    /**
+    * @brief        UTF-8을 UTF-16으로 바꿀 때 필요한 char16_t 개수 (유효한 UTF-8 기준)
+    */
+    inline size_t GetUTF16LengthFromUTF8(const char* pSrc, size_t nSrcSize) noexcept
+    {
+        const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pSrc);
+        size_t nLength = 0;
+        size_t nIdx = 0;
+#if defined(ESK_SIMD_AVX2)
+        // 연속 바이트(10______)가 아닌 바이트 수 + 4바이트 선두(11110___) 수
+        for (; nIdx + 32 <= nSrcSize; nIdx += 32)
+        {
+            const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pBytes + nIdx));
+            const uint32_t nLead = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(vData, _mm256_set1_epi8(-65))));
+            const uint32_t nFour = static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_max_epu8(vData, _mm256_set1_epi8(static_cast<char>(0xF0))), vData)));
+            nLength += std::popcount(nLead) + std::popcount(nFour);
+        }
+#endif
+        for (; nIdx < nSrcSize; ++nIdx)
+        {
+            nLength += ((pBytes[nIdx] & 0xC0) != 0x80) + (pBytes[nIdx] >= 0xF0);
+        }
+        return nLength;
+    }
+
+    /**
+    * @brief        UTF-8을 UTF-32로 바꿀 때 필요한 char32_t 개수 (유효한 UTF-8 기준)
+    */
+    inline size_t GetUTF32LengthFromUTF8(const char* pSrc, size_t nSrcSize) noexcept
+    {
+        const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pSrc);
+        size_t nLength = 0;
+        size_t nIdx = 0;
+#if defined(ESK_SIMD_AVX2)
+        for (; nIdx + 32 <= nSrcSize; nIdx += 32)
+        {
+            const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pBytes + nIdx));
+            nLength += std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(vData, _mm256_set1_epi8(-65)))));
+        }
+#endif
+        for (; nIdx < nSrcSize; ++nIdx)
+        {
+            nLength += (pBytes[nIdx] & 0xC0) != 0x80;
+        }
+        return nLength;
+    }
+
+    /**
+    * @brief        UTF-16을 UTF-8로 바꿀 때 필요한 바이트 수 (유효한 UTF-16 기준, 서로게이트 쌍은 4바이트)
+    */
+    inline size_t GetUTF8LengthFromUTF16(const char16_t* pSrc, size_t nSrcSize) noexcept
+    {
+        size_t nLength = 0;
+        size_t nIdx = 0;
+#if defined(ESK_SIMD_AVX2)
+        for (; nIdx + 16 <= nSrcSize; nIdx += 16)
+        {
+            const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + nIdx));
+            const __m256i vOver7F = _mm256_cmpeq_epi16(_mm256_max_epu16(vData, _mm256_set1_epi16(0x80)), vData);
+            const __m256i vOver7FF = _mm256_cmpeq_epi16(_mm256_max_epu16(vData, _mm256_set1_epi16(0x800)), vData);
+            const __m256i vSurrogate = _mm256_cmpeq_epi16(_mm256_and_si256(vData, _mm256_set1_epi16(static_cast<short>(0xF800))), _mm256_set1_epi16(static_cast<short>(0xD800)));
+            // 16비트 비교 결과는 movemask에서 2비트씩 나오므로 2로 나눔
+            nLength += 16 + (std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(vOver7F))) +
+                std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(vOver7FF))) -
+                std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(vSurrogate)))) / 2;
+        }
+#endif
+        for (; nIdx < nSrcSize; ++nIdx)
+        {
+            const char16_t nUnit = pSrc[nIdx];
+            nLength += nUnit < 0x80 ? 1 : nUnit < 0x800 ? 2 : (nUnit & 0xF800) == 0xD800 ? 2 : 3;
+        }
+        return nLength;
+    }
+
+    /**
+    * @brief        UTF-32를 UTF-8로 바꿀 때 필요한 바이트 수 (유효한 UTF-32 기준)
+    */
+    inline size_t GetUTF8LengthFromUTF32(const char32_t* pSrc, size_t nSrcSize) noexcept
+    {
+        size_t nLength = 0;
+        for (size_t nIdx = 0; nIdx < nSrcSize; ++nIdx)
+        {
+            nLength += detail::GetUTF8Length(pSrc[nIdx]);
+        }
+        return nLength;
+    }
+
+    /**
+    * @brief        UTF-8 -> UTF-16 변환 (검증 포함, ASCII 구간은 SIMD로 한 번에 확장)
+    * @param[in]    pSrc            UTF-8 원본
+    * @param[in]    nSrcSize        원본 바이트 수
+    * @param[out]   pDst            결과 버퍼 (GetUTF16LengthFromUTF8 만큼 필요)
+    * @param[in]    nDstSize        결과 버퍼의 char16_t 개수
+    * @param[out]   pOutSize        쓴 char16_t 개수
+    * @return       true: 성공, false: 잘못된 UTF-8 또는 버퍼 부족
+    */
+    inline bool UTF8ToUTF16(const char* pSrc, size_t nSrcSize, char16_t* pDst, size_t nDstSize, size_t* pOutSize) noexcept
+    {
+        if ((pSrc == nullptr && nSrcSize > 0) ||
+            (pDst == nullptr && nDstSize > 0) ||
+            pOutSize == nullptr)
+        {
+            return false;
+        }
+
+        const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pSrc);
+        size_t nIdx = 0;
+        size_t nOut = 0;
+        while (nIdx < nSrcSize)
+        {
+#if defined(ESK_SIMD_AVX2)
+            for (; nIdx + 32 <= nSrcSize && nOut + 32 <= nDstSize; nIdx += 32, nOut += 32)
+            {
+                const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pBytes + nIdx));
+                if (_mm256_movemask_epi8(vData) != 0)
+                {
+                    break;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + nOut), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(vData)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + nOut + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(vData, 1)));
+            }
+#elif defined(ESK_SIMD_NEON)
+            for (; nIdx + 16 <= nSrcSize && nOut + 16 <= nDstSize; nIdx += 16, nOut += 16)
+            {
+                const uint8x16_t vData = vld1q_u8(pBytes + nIdx);
+                if (vmaxvq_u8(vData) >= 0x80)
+                {
+                    break;
+                }
+                vst1q_u16(reinterpret_cast<uint16_t*>(pDst + nOut), vmovl_u8(vget_low_u8(vData)));
+                vst1q_u16(reinterpret_cast<uint16_t*>(pDst + nOut + 8), vmovl_high_u8(vData));
+            }
+#endif
+            if (nIdx >= nSrcSize)
+            {
+                break;
+            }
+
+            // ASCII가 다시 나올 때까지 글자 단위로 처리
+            do
+            {
+                char32_t nCode = 0;
+                const size_t nLength = detail::DecodeUTF8(pBytes + nIdx, nSrcSize - nIdx, &nCode);
+                if (nLength == 0)
+                {
+                    return false;
+                }
+
+                if (nCode < 0x10000)
+                {
+                    if (nOut >= nDstSize)
+                    {
+                        return false;
+                    }
+                    pDst[nOut++] = static_cast<char16_t>(nCode);
+                }
+                else
+                {
+                    if (nOut + 2 > nDstSize)
+                    {
+                        return false;
+                    }
+                    nCode -= 0x10000;
+                    pDst[nOut++] = static_cast<char16_t>(0xD800 | (nCode >> 10));
+                    pDst[nOut++] = static_cast<char16_t>(0xDC00 | (nCode & 0x3FF));
+                }
+                nIdx += nLength;
+            } while (nIdx < nSrcSize &&
+                pBytes[nIdx] >= 0x80);
+        }
+
+        *pOutSize = nOut;
+        return true;
+    }
+
+    /**
+    * @brief        UTF-8 -> UTF-32 변환 (검증 포함, ASCII 구간은 SIMD로 한 번에 확장)
+    * @param[in]    pSrc            UTF-8 원본
+    * @param[in]    nSrcSize        원본 바이트 수
+    * @param[out]   pDst            결과 버퍼 (GetUTF32LengthFromUTF8 만큼 필요)
+    * @param[in]    nDstSize        결과 버퍼의 char32_t 개수
+    * @param[out]   pOutSize        쓴 char32_t 개수
+    * @return       true: 성공, false: 잘못된 UTF-8 또는 버퍼 부족
+    */
+    inline bool UTF8ToUTF32(const char* pSrc, size_t nSrcSize, char32_t* pDst, size_t nDstSize, size_t* pOutSize) noexcept
+    {
+        if ((pSrc == nullptr && nSrcSize > 0) ||
+            (pDst == nullptr && nDstSize > 0) ||
+            pOutSize == nullptr)
+        {
+            return false;
+        }
+
+        const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pSrc);
+        size_t nIdx = 0;
+        size_t nOut = 0;
+        while (nIdx < nSrcSize)
+        {
+#if defined(ESK_SIMD_AVX2)
+            for (; nIdx + 16 <= nSrcSize && nOut + 16 <= nDstSize; nIdx += 16, nOut += 16)
+            {
+                const __m128i vData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBytes + nIdx));
+                if (_mm_movemask_epi8(vData) != 0)
+                {
+                    break;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + nOut), _mm256_cvtepu8_epi32(vData));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + nOut + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(vData, 8)));
+            }
+#elif defined(ESK_SIMD_NEON)
+            for (; nIdx + 16 <= nSrcSize && nOut + 16 <= nDstSize; nIdx += 16, nOut += 16)
+            {
+                const uint8x16_t vData = vld1q_u8(pBytes + nIdx);
+                if (vmaxvq_u8(vData) >= 0x80)
+                {
+                    break;
+                }
+                const uint16x8_t vLow = vmovl_u8(vget_low_u8(vData));
+                const uint16x8_t vHigh = vmovl_high_u8(vData);
+                uint32_t* pOut = reinterpret_cast<uint32_t*>(pDst + nOut);
+                vst1q_u32(pOut, vmovl_u16(vget_low_u16(vLow)));
+                vst1q_u32(pOut + 4, vmovl_high_u16(vLow));
+                vst1q_u32(pOut + 8, vmovl_u16(vget_low_u16(vHigh)));
+                vst1q_u32(pOut + 12, vmovl_high_u16(vHigh));
+            }
+#endif
+            if (nIdx >= nSrcSize)
+            {
+                break;
+            }
+
+            do
+            {
+                char32_t nCode = 0;
+                const size_t nLength = detail::DecodeUTF8(pBytes + nIdx, nSrcSize - nIdx, &nCode);
+                if (nLength == 0 ||
+                    nOut >= nDstSize)
+                {
+                    return false;
+                }
+                pDst[nOut++] = nCode;
+                nIdx += nLength;
+            } while (nIdx < nSrcSize &&
+                pBytes[nIdx] >= 0x80);
+        }
+
+        *pOutSize = nOut;
+        return true;
+    }
+
+    /**
+    * @brief        UTF-16 -> UTF-8 변환 (짝이 맞지 않는 서로게이트는 오류)
+    * @param[in]    pSrc            UTF-16 원본
+    * @param[in]    nSrcSize        원본 char16_t 개수
+    * @param[out]   pDst            결과 버퍼 (GetUTF8LengthFromUTF16 만큼 필요)
+    * @param[in]    nDstSize        결과 버퍼 바이트 수
+    * @param[out]   pOutSize        쓴 바이트 수
+    * @return       true: 성공, false: 잘못된 UTF-16 또는 버퍼 부족
+    */
+    inline bool UTF16ToUTF8(const char16_t* pSrc, size_t nSrcSize, char* pDst, size_t nDstSize, size_t* pOutSize) noexcept
+    {
+        if ((pSrc == nullptr && nSrcSize > 0) ||
+            (pDst == nullptr && nDstSize > 0) ||
+            pOutSize == nullptr)
+        {
+            return false;
+        }
+
+        size_t nIdx = 0;
+        size_t nOut = 0;
+        while (nIdx < nSrcSize)
+        {
+#if defined(ESK_SIMD_AVX2)
+            for (; nIdx + 16 <= nSrcSize && nOut + 16 <= nDstSize; nIdx += 16, nOut += 16)
+            {
+                const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + nIdx));
+                if (!_mm256_testz_si256(vData, _mm256_set1_epi16(static_cast<short>(0xFF80))))
+                {
+                    break;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + nOut),
+                    _mm_packus_epi16(_mm256_castsi256_si128(vData), _mm256_extracti128_si256(vData, 1)));
+            }
+#elif defined(ESK_SIMD_NEON)
+            for (; nIdx + 8 <= nSrcSize && nOut + 8 <= nDstSize; nIdx += 8, nOut += 8)
+            {
+                const uint16x8_t vData = vld1q_u16(reinterpret_cast<const uint16_t*>(pSrc + nIdx));
+                if (vmaxvq_u16(vData) >= 0x80)
+                {
+                    break;
+                }
+                vst1_u8(reinterpret_cast<uint8_t*>(pDst + nOut), vmovn_u16(vData));
+            }
+#endif
+            if (nIdx >= nSrcSize)
+            {
+                break;
+            }
+
+            do
+            {
+                char32_t nCode = pSrc[nIdx];
+                size_t nUnits = 1;
+                if ((nCode & 0xF800) == 0xD800)
+                {
+                    if (nCode >= 0xDC00 ||
+                        nIdx + 1 >= nSrcSize ||
+                        (pSrc[nIdx + 1] & 0xFC00) != 0xDC00)
+                    {
+                        return false;
+                    }
+                    nCode = 0x10000 + ((nCode - 0xD800) << 10) + (pSrc[nIdx + 1] - 0xDC00);
+                    nUnits = 2;
+                }
+
+                if (nOut + detail::GetUTF8Length(nCode) > nDstSize)
+                {
+                    return false;
+                }
+                nOut += detail::EncodeUTF8(nCode, pDst + nOut);
+                nIdx += nUnits;
+            } while (nIdx < nSrcSize &&
+                pSrc[nIdx] >= 0x80);
+        }
+
+        *pOutSize = nOut;
+        return true;
+    }
+
+    /**
+    * @brief        UTF-32 -> UTF-8 변환 (서로게이트 영역, U+10FFFF 초과는 오류)
+    * @param[in]    pSrc            UTF-32 원본
+    * @param[in]    nSrcSize        원본 char32_t 개수
+    * @param[out]   pDst            결과 버퍼 (GetUTF8LengthFromUTF32 만큼 필요)
+    * @param[in]    nDstSize        결과 버퍼 바이트 수
+    * @param[out]   pOutSize        쓴 바이트 수
+    * @return       true: 성공, false: 잘못된 코드 포인트 또는 버퍼 부족
+    */
+    inline bool UTF32ToUTF8(const char32_t* pSrc, size_t nSrcSize, char* pDst, size_t nDstSize, size_t* pOutSize) noexcept
+    {
+        if ((pSrc == nullptr && nSrcSize > 0) ||
+            (pDst == nullptr && nDstSize > 0) ||
+            pOutSize == nullptr)
+        {
+            return false;
+        }
+
+        size_t nIdx = 0;
+        size_t nOut = 0;
+        while (nIdx < nSrcSize)
+        {
+#if defined(ESK_SIMD_AVX2)
+            for (; nIdx + 8 <= nSrcSize && nOut + 8 <= nDstSize; nIdx += 8, nOut += 8)
+            {
+                const __m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + nIdx));
+                if (!_mm256_testz_si256(vData, _mm256_set1_epi32(static_cast<int>(0xFFFFFF80))))
+                {
+                    break;
+                }
+                const __m128i vWords = _mm_packus_epi32(_mm256_castsi256_si128(vData), _mm256_extracti128_si256(vData, 1));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + nOut), _mm_packus_epi16(vWords, vWords));
+            }
+#elif defined(ESK_SIMD_NEON)
+            for (; nIdx + 8 <= nSrcSize && nOut + 8 <= nDstSize; nIdx += 8, nOut += 8)
+            {
+                const uint32x4_t vLow = vld1q_u32(reinterpret_cast<const uint32_t*>(pSrc + nIdx));
+                const uint32x4_t vHigh = vld1q_u32(reinterpret_cast<const uint32_t*>(pSrc + nIdx + 4));
+                if (vmaxvq_u32(vorrq_u32(vLow, vHigh)) >= 0x80)
+                {
+                    break;
+                }
+                vst1_u8(reinterpret_cast<uint8_t*>(pDst + nOut), vmovn_u16(vcombine_u16(vmovn_u32(vLow), vmovn_u32(vHigh))));
+            }
+#endif
+            if (nIdx >= nSrcSize)
+            {
+                break;
+            }
+
+            do
+            {
+                const char32_t nCode = pSrc[nIdx];
+                if (nCode > 0x10FFFF ||
+                    (nCode >= 0xD800 && nCode <= 0xDFFF) ||
+                    nOut + detail::GetUTF8Length(nCode) > nDstSize)
+                {
+                    return false;
+                }
+                nOut += detail::EncodeUTF8(nCode, pDst + nOut);
+                ++nIdx;
+            } while (nIdx < nSrcSize &&
+                pSrc[nIdx] >= 0x80);
+        }
+
+        *pOutSize = nOut;
+        return true;
+    }
+    /**
+    * @brief        재사용 가능한 버퍼에 문자열을 이어 붙이는 빌더
+    * @details      Clear()는 용량을 유지하므로 같은 빌더를 계속 쓰면 정상 상태에서 메시지당 힙 할당이 없다.
+    *               호출자 버퍼(스택 등)를 넘기면 그 버퍼부터 쓰고, 넘칠 때만 힙으로 옮긴다.
+    *               정수/실수는 std::to_chars, Format은 컴파일 타임에 검사되는 std::format_string을 사용한다. (<format> 지원 시)
+    *               결과는 항상 '\0'으로 끝난다. (GetCString)
+    */
+    class StringBuilder
+    {
+    public:
+        StringBuilder() noexcept
+            : m_pData(m_arrEmpty)
+        {
+        }
+
+        /**
+        * @brief        nReserve 바이트를 미리 잡아 두는 생성자
+        */
+        explicit StringBuilder(size_t nReserve)
+            : m_pData(m_arrEmpty)
+        {
+            Reserve(nReserve);
+        }
+
+        /**
+        * @brief        호출자 버퍼를 쓰는 생성자 (넘치면 힙으로 옮김)
+        * @param[in]    pBuffer         사용할 버퍼 (빌더보다 오래 살아 있어야 함)
+        * @param[in]    nBufferSize     버퍼 크기 ('\0' 자리 포함)
+        */
+        StringBuilder(char* pBuffer, size_t nBufferSize) noexcept
+            : m_pData(m_arrEmpty)
+        {
+            if (pBuffer != nullptr &&
+                nBufferSize > 0)
+            {
+                m_pData = pBuffer;
+                m_nCapacity = nBufferSize - 1;
+                m_pData[0] = '\0';
+            }
+        }
+
+        StringBuilder(const StringBuilder&) = delete;
+        StringBuilder& operator=(const StringBuilder&) = delete;
+
+        /**
+        * @brief        최소 nCapacity 글자를 담을 수 있도록 확보
+        */
+        void Reserve(size_t nCapacity)
+        {
+            if (nCapacity <= m_nCapacity)
+            {
+                return;
+            }
+
+            size_t nNewCapacity = m_nCapacity * 2 > 64 ? m_nCapacity * 2 : 64;
+            if (nNewCapacity < nCapacity)
+            {
+                nNewCapacity = nCapacity;
+            }
+            std::unique_ptr<char[]> pNew = std::make_unique_for_overwrite<char[]>(nNewCapacity + 1);
+            ::memcpy(pNew.get(), m_pData, m_nSize + 1);
+            m_pHeap = std::move(pNew);
+            m_pData = m_pHeap.get();
+            m_nCapacity = nNewCapacity;
+        }
+
+        StringBuilder& Append(std::string_view svText)
+        {
+            Reserve(m_nSize + svText.size());
+            if (!svText.empty())
+            {
+                ::memcpy(m_pData + m_nSize, svText.data(), svText.size());
+            }
+            m_nSize += svText.size();
+            m_pData[m_nSize] = '\0';
+            return *this;
+        }
+
+        StringBuilder& Append(const char* pszText)
+        {
+            return pszText == nullptr ? *this : Append(std::string_view(pszText));
+        }
+
+        StringBuilder& Append(char ch)
+        {
+            Reserve(m_nSize + 1);
+            m_pData[m_nSize++] = ch;
+            m_pData[m_nSize] = '\0';
+            return *this;
+        }
+
+        StringBuilder& Append(char ch, size_t nCount)
+        {
+            Reserve(m_nSize + nCount);
+            ::memset(m_pData + m_nSize, ch, nCount);
+            m_nSize += nCount;
+            m_pData[m_nSize] = '\0';
+            return *this;
+        }
+
+        StringBuilder& Append(bool bValue)
+        {
+            return Append(bValue ? std::string_view("true") : std::string_view("false"));
+        }
+
+        /**
+        * @brief        정수 추가 (std::to_chars)
+        * @param[in]    nValue          값
+        * @param[in]    nBase           진법 (2 ~ 36)
+        */
+        template <typename T>
+            requires (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>)
+        StringBuilder& Append(T nValue, int nBase = 10)
+        {
+            char arrDigits[sizeof(T) * 8 + 1];
+            const std::to_chars_result result = std::to_chars(arrDigits, arrDigits + sizeof(arrDigits), nValue, nBase);
+            return Append(std::string_view(arrDigits, result.ptr - arrDigits));
+        }
+
+        /**
+        * @brief        실수 추가 (std::to_chars, 왕복 가능한 최단 표현)
+        */
+        template <typename T>
+            requires std::is_floating_point_v<T>
+        StringBuilder& Append(T dValue)
+        {
+            char arrDigits[64];
+            const std::to_chars_result result = std::to_chars(arrDigits, arrDigits + sizeof(arrDigits), dValue);
+            return Append(std::string_view(arrDigits, result.ptr - arrDigits));
+        }
+
+        /**
+        * @brief        실수를 소수점 아래 nPrecision 자리로 추가 (std::chars_format::fixed)
+        */
+        template <typename T>
+            requires std::is_floating_point_v<T>
+        StringBuilder& AppendFixed(T dValue, int nPrecision)
+        {
+            // 고정 소수점은 지수가 큰 값에서 길어지므로 남은 공간에 직접 쓰고, 모자라면 넓혀서 다시 씀
+            for (size_t nSpace = 64 + static_cast<size_t>(nPrecision > 0 ? nPrecision : 0);; nSpace *= 8)
+            {
+                Reserve(m_nSize + nSpace);
+                const std::to_chars_result result = std::to_chars(m_pData + m_nSize, m_pData + m_nCapacity, dValue, std::chars_format::fixed, nPrecision);
+                if (result.ec == std::errc())
+                {
+                    m_nSize = result.ptr - m_pData;
+                    m_pData[m_nSize] = '\0';
+                    return *this;
+                }
+            }
+        }
+
+#if defined(__cpp_lib_format)
+        /**
+        * @brief        std::format 서식으로 추가 (서식 문자열은 컴파일 타임 검사)
+        * @details      남은 공간에 바로 쓰고, 모자랄 때만 필요한 크기로 넓혀 한 번 더 쓴다.
+        *               (인자는 참조로만 넘어가므로 두 번 전달해도 이동되지 않음)
+        */
+        template <typename... Args>
+        StringBuilder& Format(std::format_string<Args...> fmt, Args&&... args)
+        {
+            const size_t nRemain = m_nCapacity - m_nSize;
+            const std::format_to_n_result<char*> result = std::format_to_n(m_pData + m_nSize, nRemain, fmt, std::forward<Args>(args)...);
+            const size_t nWritten = static_cast<size_t>(result.size);
+            if (nWritten > nRemain)
+            {
+                Reserve(m_nSize + nWritten);
+                std::format_to(m_pData + m_nSize, fmt, std::forward<Args>(args)...);
+            }
+            m_nSize += nWritten;
+            m_pData[m_nSize] = '\0';
+            return *this;
+        }
+#endif
+
+        /**
+        * @brief        내용만 비움 (용량 유지)
+        */
+        void Clear() noexcept
+        {
+            m_nSize = 0;
+            m_pData[0] = '\0';
+        }
+
+        size_t GetSize() const noexcept
+        {
+            return m_nSize;
+        }
+
+        size_t GetCapacity() const noexcept
+        {
+            return m_nCapacity;
+        }
+
+        bool IsEmpty() const noexcept
+        {
+            return m_nSize == 0;
+        }
+
+        /**
+        * @brief        힙으로 옮겨졌는지 여부 (호출자 버퍼가 모자랐거나 Reserve 한 경우)
+        */
+        bool IsHeap() const noexcept
+        {
+            return m_pHeap != nullptr;
+        }
+
+        const char* GetCString() const noexcept
+        {
+            return m_pData;
+        }
+
+        std::string_view GetView() const noexcept
+        {
+            return std::string_view(m_pData, m_nSize);
+        }
+
+        std::string ToString() const
+        {
+            return std::string(m_pData, m_nSize);
+        }
+
+    private:
+        char m_arrEmpty[1]{};
+        char* m_pData;
+        size_t m_nSize = 0;
+        size_t m_nCapacity = 0;
+        std::unique_ptr<char[]> m_pHeap;
+    };
+
+    namespace detail
+    {
+        /**
+        * @brief        StackStringBuilder의 내장 버퍼 (StringBuilder보다 먼저 생성되도록 별도 기반 클래스로 둠)
+        */
+        template <size_t N>
+        struct StackBufferStorage
+        {
+            char m_arrBuffer[N];
+        };
+    } // namespace detail
+
+    /**
+    * @brief        N 바이트 내장 버퍼를 쓰는 StringBuilder (지역 변수로 쓰면 스택에서 처리, 넘치면 힙)
+    */
+    template <size_t N>
+    class StackStringBuilder : private detail::StackBufferStorage<N>, public StringBuilder
+    {
+    public:
+        // 기반 클래스는 선언 순서대로 생성되므로 StringBuilder가 '\0'을 쓸 때 버퍼의 수명은 이미 시작된 상태
+        StackStringBuilder() noexcept
+            : StringBuilder(this->m_arrBuffer, N)
+        {
+        }
+    };
+} // namespace esk::util_str
+
+template <size_t N>
+struct std::hash<esk::gearforge::util::str::FixedString<N>>
+{
+    size_t operator()(const esk::gearforge::util::str::FixedString<N>& text) const noexcept
+    {
+        return static_cast<size_t>(esk::gearforge::util::str::HashString(text.GetView()));
+    }
+};
\ No newline at end of file
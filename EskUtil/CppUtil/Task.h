@@ -0,0 +1,865 @@
+﻿/**
+* @file			Task.h
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		Task Utility (작업 훔치기 스레드 풀)
+*/
+
+#pragma once
+#include "Common.h"
+#include "Thread.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace esk::gearforge::util::task
+{
+    class ThreadPool;
+
+    /**
+    * @brief        취소된 작업의 Future에서 Get을 호출하면 던지는 예외
+    */
+    class TaskCancelled : public std::runtime_error
+    {
+    public:
+        TaskCancelled()
+            : std::runtime_error("task cancelled")
+        {
+        }
+    };
+
+    /**
+    * @brief        협력형 취소 토큰 (작업이 IsCancelled를 확인해 스스로 멈춤)
+    * @details      기본 생성한 토큰은 취소되지 않는다.
+    */
+    class CancellationToken
+    {
+    public:
+        CancellationToken() = default;
+
+        bool IsCancelled() const noexcept
+        {
+            return m_pFlag != nullptr && m_pFlag->load(std::memory_order_acquire);
+        }
+
+    private:
+        friend class CancellationSource;
+
+        explicit CancellationToken(std::shared_ptr<std::atomic<bool>> pFlag)
+            : m_pFlag(std::move(pFlag))
+        {
+        }
+
+        std::shared_ptr<std::atomic<bool>> m_pFlag;
+    };
+
+    /**
+    * @brief        취소 토큰 발급/취소 (EskTask의 CancellationTokenSource에 해당)
+    */
+    class CancellationSource
+    {
+    public:
+        CancellationSource()
+            : m_pFlag(std::make_shared<std::atomic<bool>>(false))
+        {
+        }
+
+        void Cancel() noexcept
+        {
+            m_pFlag->store(true, std::memory_order_release);
+        }
+
+        bool IsCancelled() const noexcept
+        {
+            return m_pFlag->load(std::memory_order_acquire);
+        }
+
+        CancellationToken GetToken() const
+        {
+            return CancellationToken(m_pFlag);
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> m_pFlag;
+    };
+
+    namespace detail
+    {
+        /**
+        * @brief        풀에 넣는 작업 (함수 객체와 이름을 한 번의 할당으로 담음)
+        */
+        class TaskBase
+        {
+        public:
+            virtual ~TaskBase() = default;
+            virtual void Run() = 0;
+
+            std::string strName;
+        };
+
+        template<typename Func>
+        class TaskImpl final : public TaskBase
+        {
+        public:
+            template<typename F>
+            explicit TaskImpl(F&& func)
+                : m_func(std::forward<F>(func))
+            {
+            }
+
+            void Run() override
+            {
+                m_func();
+            }
+
+        private:
+            Func m_func;
+        };
+
+        /**
+        * @brief        Chase-Lev 작업 훔치기 덱 (Lê et al. 2013의 C11 메모리 모델 버전)
+        * @details      소유 스레드만 Push/Pop(아래쪽)을 하고, 다른 스레드는 Steal(위쪽)로 가져간다.
+        *               배열이 차면 두 배로 키우며, 훔치는 쪽이 아직 읽고 있을 수 있는 옛 배열은 덱이 사라질 때 해제한다.
+        */
+        template<typename T>
+        class WorkStealingDeque
+        {
+            static_assert(std::is_pointer_v<T>, "WorkStealingDeque holds pointers (nullptr = empty)");
+
+        public:
+            explicit WorkStealingDeque(int64_t nCapacity = 256)
+            {
+                m_vArrays.push_back(std::make_unique<Array>(std::bit_ceil(static_cast<uint64_t>(std::max<int64_t>(nCapacity, 2)))));
+                m_pArray.store(m_vArrays.back().get(), std::memory_order_relaxed);
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            /**
+            * @brief        아래쪽에 추가 (소유 스레드 전용)
+            */
+            void Push(T pItem)
+            {
+                const int64_t nBottom = m_nBottom.load(std::memory_order_relaxed);
+                const int64_t nTop = m_nTop.load(std::memory_order_acquire);
+                Array* pArray = m_pArray.load(std::memory_order_relaxed);
+                if (nBottom - nTop > pArray->nMask)
+                {
+                    pArray = Grow(pArray, nTop, nBottom);
+                }
+                pArray->Put(nBottom, pItem);
+                m_nBottom.store(nBottom + 1, std::memory_order_release);
+            }
+
+            /**
+            * @brief        아래쪽에서 꺼냄 (소유 스레드 전용, 비었으면 nullptr)
+            */
+            T Pop()
+            {
+                const int64_t nBottom = m_nBottom.load(std::memory_order_relaxed) - 1;
+                Array* pArray = m_pArray.load(std::memory_order_relaxed);
+                m_nBottom.store(nBottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t nTop = m_nTop.load(std::memory_order_relaxed);
+
+                if (nTop > nBottom)
+                {
+                    m_nBottom.store(nBottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                T pItem = pArray->Get(nBottom);
+                if (nTop == nBottom)
+                {
+                    // 마지막 하나는 훔치는 쪽과 경쟁
+                    if (!m_nTop.compare_exchange_strong(nTop, nTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                        pItem = nullptr;
+                    }
+                    m_nBottom.store(nBottom + 1, std::memory_order_relaxed);
+                }
+                return pItem;
+            }
+
+            /**
+            * @brief        위쪽에서 훔침 (아무 스레드, 비었거나 경쟁에서 지면 nullptr)
+            */
+            T Steal()
+            {
+                int64_t nTop = m_nTop.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t nBottom = m_nBottom.load(std::memory_order_acquire);
+                if (nTop >= nBottom)
+                {
+                    return nullptr;
+                }
+
+                T pItem = m_pArray.load(std::memory_order_acquire)->Get(nTop);
+                if (!m_nTop.compare_exchange_strong(nTop, nTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    return nullptr;
+                }
+                return pItem;
+            }
+
+            bool IsEmpty() const noexcept
+            {
+                return m_nBottom.load(std::memory_order_relaxed) <= m_nTop.load(std::memory_order_relaxed);
+            }
+
+        private:
+            struct Array
+            {
+                explicit Array(uint64_t nCapacity)
+                    : nMask(static_cast<int64_t>(nCapacity) - 1)
+                    , pItems(std::make_unique<std::atomic<T>[]>(nCapacity))
+                {
+                }
+
+                T Get(int64_t nIdx) const noexcept
+                {
+                    return pItems[nIdx & nMask].load(std::memory_order_relaxed);
+                }
+
+                void Put(int64_t nIdx, T pItem) noexcept
+                {
+                    pItems[nIdx & nMask].store(pItem, std::memory_order_relaxed);
+                }
+
+                const int64_t nMask;
+                std::unique_ptr<std::atomic<T>[]> pItems;
+            };
+
+            Array* Grow(Array* pOld, int64_t nTop, int64_t nBottom)
+            {
+                m_vArrays.push_back(std::make_unique<Array>(static_cast<uint64_t>(pOld->nMask + 1) * 2));
+                Array* pNew = m_vArrays.back().get();
+                for (int64_t i = nTop; i < nBottom; ++i)
+                {
+                    pNew->Put(i, pOld->Get(i));
+                }
+                m_pArray.store(pNew, std::memory_order_release);
+                return pNew;
+            }
+
+            alignas(64) std::atomic<int64_t> m_nTop{ 0 };
+            alignas(64) std::atomic<int64_t> m_nBottom{ 0 };
+            std::atomic<Array*> m_pArray{ nullptr };
+            std::vector<std::unique_ptr<Array>> m_vArrays;  ///< 소유 스레드만 접근
+        };
+
+        /**
+        * @brief        현재 스레드가 어느 풀의 몇 번째 작업 스레드인지, 지금 실행 중인 작업
+        */
+        struct WorkerContext
+        {
+            ThreadPool* pPool = nullptr;
+            size_t nIdx = 0;
+            uint64_t nRandom = 0;
+            const TaskBase* pCurrentTask = nullptr;
+        };
+
+        inline WorkerContext& GetWorkerContext() noexcept
+        {
+            thread_local WorkerContext context;
+            return context;
+        }
+
+        /**
+        * @brief        Future가 공유하는 결과 상태
+        */
+        template<typename R>
+        struct FutureState
+        {
+            using Value = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+
+            template<typename... Args>
+            void SetValue(Args&&... args)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                value.emplace(std::forward<Args>(args)...);
+                Complete(lock);
+            }
+
+            void SetException(std::exception_ptr pError)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                pException = std::move(pError);
+                Complete(lock);
+            }
+
+            /**
+            * @brief        완료 시 호출할 함수 등록 (이미 완료됐으면 바로 호출)
+            */
+            void AddContinuation(std::function<void()> func)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!bIsReady.load(std::memory_order_relaxed))
+                    {
+                        vContinuations.push_back(std::move(func));
+                        return;
+                    }
+                }
+                func();
+            }
+
+            void Complete(std::unique_lock<std::mutex>& lock)
+            {
+                bIsReady.store(true, std::memory_order_release);
+                std::vector<std::function<void()>> vFuncs = std::move(vContinuations);
+                lock.unlock();
+                cv.notify_all();
+                for (std::function<void()>& func : vFuncs)
+                {
+                    func();
+                }
+            }
+
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::atomic<bool> bIsReady{ false };
+            std::optional<Value> value;
+            std::exception_ptr pException;
+            std::vector<std::function<void()>> vContinuations;
+        };
+
+        /**
+        * @brief        Future<R>::Then에 넘긴 함수의 반환형
+        */
+        template<typename Func, typename R>
+        struct ThenResult
+        {
+            using type = std::invoke_result_t<Func&, const R&>;
+        };
+
+        template<typename Func>
+        struct ThenResult<Func, void>
+        {
+            using type = std::invoke_result_t<Func&>;
+        };
+    }
+
+    /**
+    * @brief        ThreadPool::Async의 결과 (복사 가능, 결과는 공유)
+    * @details      작업 스레드에서 Wait/Get을 호출하면 기다리는 동안 다른 작업을 대신 실행하므로 중첩 대기로 멈추지 않는다.
+    */
+    template<typename R>
+    class Future
+    {
+    public:
+        Future() = default;
+
+        bool IsValid() const noexcept
+        {
+            return m_pState != nullptr;
+        }
+
+        bool IsReady() const noexcept
+        {
+            return m_pState != nullptr && m_pState->bIsReady.load(std::memory_order_acquire);
+        }
+
+        void Wait() const;
+
+        /**
+        * @brief        결과 반환 (완료될 때까지 대기, 작업이 던진 예외나 TaskCancelled를 다시 던짐)
+        * @return       R이 void가 아니면 결과의 const 참조 (Future가 살아 있는 동안 유효)
+        */
+        decltype(auto) Get() const
+        {
+            Wait();
+            if (m_pState->pException)
+            {
+                std::rethrow_exception(m_pState->pException);
+            }
+            if constexpr (!std::is_void_v<R>)
+            {
+                return static_cast<const R&>(*m_pState->value);
+            }
+        }
+
+        /**
+        * @brief        완료 후 풀에서 실행할 후속 작업 등록
+        * @param[in]    func            R이 void면 func(), 아니면 func(const R&)
+        * @return       후속 작업의 Future (앞 작업이 실패하면 같은 예외로 완료)
+        */
+        template<typename Func>
+        auto Then(Func&& func) const;
+
+    private:
+        friend class ThreadPool;
+
+        template<typename U>
+        friend class Future;
+
+        Future(std::shared_ptr<detail::FutureState<R>> pState, ThreadPool* pPool)
+            : m_pState(std::move(pState))
+            , m_pPool(pPool)
+        {
+        }
+
+        std::shared_ptr<detail::FutureState<R>> m_pState;
+        ThreadPool* m_pPool = nullptr;
+    };
+
+    /**
+    * @brief        작업 훔치기 스레드 풀 (EskTask의 C++ 대응)
+    * @details      작업 스레드마다 Chase-Lev 덱을 두고, 작업 스레드가 넣은 작업은 자기 덱 아래쪽에 쌓아 LIFO로 처리한다.
+    *               자기 덱이 비면 외부 스레드용 공용 큐, 그 다음 다른 작업 스레드의 덱 위쪽을 훔친다.
+    *               할 일이 없으면 조건 변수로 잠들며, 작업을 넣는 쪽은 잠든 스레드가 있을 때만 깨운다.
+    */
+    class ThreadPool
+    {
+    public:
+        /**
+        * @param[in]    nThreadCount    작업 스레드 수 (0이면 하드웨어 스레드 수)
+        * @param[in]    bIsPinned       true면 i번째 작업 스레드를 (i % 하드웨어 스레드 수)번 CPU에 고정
+        */
+        explicit ThreadPool(size_t nThreadCount = 0, bool bIsPinned = false)
+        {
+            const size_t nCoreCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            if (nThreadCount == 0)
+            {
+                nThreadCount = nCoreCount;
+            }
+
+            for (size_t i = 0; i < nThreadCount; ++i)
+            {
+                m_vQueues.push_back(std::make_unique<detail::WorkStealingDeque<detail::TaskBase*>>());
+            }
+            for (size_t i = 0; i < nThreadCount; ++i)
+            {
+                m_vWorkers.emplace_back([this, i, bIsPinned, nCoreCount]()
+                    {
+                        if (bIsPinned)
+                        {
+                            thread::SetCurrentThreadAffinity(static_cast<uint32_t>(i % nCoreCount));
+                        }
+                        WorkerLoop(i);
+                    });
+            }
+        }
+
+        /**
+        * @brief        남은 작업을 모두 실행한 뒤 작업 스레드 종료
+        */
+        ~ThreadPool()
+        {
+            m_bIsStop.store(true, std::memory_order_seq_cst);
+            {
+                std::lock_guard<std::mutex> lock(m_mutexSleep);
+            }
+            m_cvSleep.notify_all();
+            for (std::thread& worker : m_vWorkers)
+            {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t GetThreadCount() const noexcept
+        {
+            return m_vWorkers.size();
+        }
+
+        /**
+        * @brief        결과 없이 실행할 작업 추가 (작업이 던진 예외는 무시)
+        */
+        template<typename Func>
+        void Submit(Func&& func)
+        {
+            Push(new detail::TaskImpl<std::decay_t<Func>>(std::forward<Func>(func)));
+        }
+
+        /**
+        * @brief        이름 있는 작업 추가
+        * @param[in]    svName          작업 이름 (실행 중 GetCurrentTaskName으로 조회)
+        * @param[in]    func            작업 함수 (인자 없음)
+        * @param[in]    token           시작 전에 취소되면 실행하지 않고 TaskCancelled로 완료
+        * @return       결과 Future
+        */
+        template<typename Func>
+        auto Async(std::string_view svName, Func&& func, CancellationToken token = {})
+        {
+            using R = std::invoke_result_t<std::decay_t<Func>&>;
+            std::shared_ptr<detail::FutureState<R>> pState = std::make_shared<detail::FutureState<R>>();
+            auto run = [pState, token = std::move(token), func = std::forward<Func>(func)]() mutable
+                {
+                    if (token.IsCancelled())
+                    {
+                        pState->SetException(std::make_exception_ptr(TaskCancelled()));
+                        return;
+                    }
+                    Fulfill(*pState, func);
+                };
+            detail::TaskBase* pTask = new detail::TaskImpl<decltype(run)>(std::move(run));
+            pTask->strName = svName;
+            Push(pTask);
+            return Future<R>(std::move(pState), this);
+        }
+
+        template<typename Func>
+        auto Async(Func&& func)
+        {
+            return Async(std::string_view(), std::forward<Func>(func));
+        }
+
+        /**
+        * @brief        [nBegin, nEnd) 구간의 각 i에 대해 func(i)를 나눠 실행하고 모두 끝날 때까지 대기
+        * @details      nGrain개씩 묶은 조각을 원자 카운터로 나눠 가지며, 호출한 스레드도 함께 실행한다.
+        *               func가 예외를 던지면 나머지 조각을 마친 뒤 첫 예외를 다시 던진다.
+        * @param[in]    nGrain          한 번에 가져갈 개수 (0이면 스레드당 8조각이 되도록 자동)
+        */
+        template<typename Func>
+        void ParallelFor(size_t nBegin, size_t nEnd, Func&& func, size_t nGrain = 0)
+        {
+            if (nEnd <= nBegin)
+            {
+                return;
+            }
+
+            const size_t nCount = nEnd - nBegin;
+            if (nGrain == 0)
+            {
+                nGrain = std::max<size_t>(nCount / (GetThreadCount() * 8), 1);
+            }
+            const size_t nChunkCount = (nCount + nGrain - 1) / nGrain;
+
+            struct ForState
+            {
+                std::atomic<size_t> nNext{ 0 };
+                std::atomic<size_t> nDone{ 0 };
+                std::mutex mutexError;
+                std::exception_ptr pError;
+            };
+            std::shared_ptr<ForState> pState = std::make_shared<ForState>();
+
+            // 늦게 시작한 도우미는 남은 조각이 없으면 func를 건드리지 않고 끝나므로 참조로 잡아도 됨
+            auto runChunks = [pState, &func, nBegin, nEnd, nGrain, nChunkCount]()
+                {
+                    size_t nChunk = 0;
+                    while ((nChunk = pState->nNext.fetch_add(1, std::memory_order_relaxed)) < nChunkCount)
+                    {
+                        const size_t nFirst = nBegin + nChunk * nGrain;
+                        const size_t nLast = (std::min)(nFirst + nGrain, nEnd);
+                        try
+                        {
+                            for (size_t i = nFirst; i < nLast; ++i)
+                            {
+                                func(i);
+                            }
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(pState->mutexError);
+                            if (!pState->pError)
+                            {
+                                pState->pError = std::current_exception();
+                            }
+                        }
+                        pState->nDone.fetch_add(1, std::memory_order_acq_rel);
+                    }
+                };
+
+            const size_t nHelperCount = (std::min)(GetThreadCount(), nChunkCount - 1);
+            for (size_t i = 0; i < nHelperCount; ++i)
+            {
+                Submit(runChunks);
+            }
+            runChunks();
+            HelpUntil([&pState, nChunkCount]() { return pState->nDone.load(std::memory_order_acquire) == nChunkCount; });
+
+            if (pState->pError)
+            {
+                std::rethrow_exception(pState->pError);
+            }
+        }
+
+        /**
+        * @brief        대기 중인 작업 하나를 현재 스레드에서 실행 (없으면 false)
+        */
+        bool TryRunOne()
+        {
+            detail::TaskBase* pTask = Take();
+            if (pTask == nullptr)
+            {
+                return false;
+            }
+            Execute(pTask);
+            return true;
+        }
+
+        /**
+        * @brief        현재 실행 중인 작업의 이름 (작업 밖이거나 이름이 없으면 빈 문자열)
+        */
+        static std::string_view GetCurrentTaskName() noexcept
+        {
+            const detail::TaskBase* pTask = detail::GetWorkerContext().pCurrentTask;
+            return pTask != nullptr ? std::string_view(pTask->strName) : std::string_view();
+        }
+
+        /**
+        * @brief        현재 스레드가 이 풀의 작업 스레드인지 여부
+        */
+        bool IsWorkerThread() const noexcept
+        {
+            return detail::GetWorkerContext().pPool == this;
+        }
+
+    private:
+        template<typename R>
+        friend class Future;
+
+        template<typename R, typename Func, typename... Args>
+        static void Fulfill(detail::FutureState<R>& state, Func& func, Args&&... args)
+        {
+            try
+            {
+                if constexpr (std::is_void_v<R>)
+                {
+                    func(std::forward<Args>(args)...);
+                    state.SetValue();
+                }
+                else
+                {
+                    state.SetValue(func(std::forward<Args>(args)...));
+                }
+            }
+            catch (...)
+            {
+                state.SetException(std::current_exception());
+            }
+        }
+
+        /**
+        * @brief        조건이 참이 될 때까지 다른 작업을 실행하며 대기
+        */
+        template<typename Pred>
+        void HelpUntil(Pred&& pred)
+        {
+            uint32_t nIdleCount = 0;
+            while (!pred())
+            {
+                if (TryRunOne())
+                {
+                    nIdleCount = 0;
+                }
+                else if (++nIdleCount > 64)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void Push(detail::TaskBase* pTask)
+        {
+            detail::WorkerContext& context = detail::GetWorkerContext();
+            if (context.pPool == this)
+            {
+                m_vQueues[context.nIdx]->Push(pTask);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(m_mutexGlobal);
+                m_queGlobal.push_back(pTask);
+            }
+
+            m_nQueuedCount.fetch_add(1, std::memory_order_seq_cst);
+            if (m_nSleepingCount.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutexSleep);
+                }
+                m_cvSleep.notify_one();
+            }
+        }
+
+        /**
+        * @brief        자기 덱 -> 공용 큐 -> 다른 덱 순서로 작업 하나를 가져옴
+        */
+        detail::TaskBase* Take()
+        {
+            if (m_nQueuedCount.load(std::memory_order_relaxed) <= 0)
+            {
+                return nullptr;
+            }
+
+            detail::WorkerContext& context = detail::GetWorkerContext();
+            const bool bIsWorker = context.pPool == this;
+            detail::TaskBase* pTask = bIsWorker ? m_vQueues[context.nIdx]->Pop() : nullptr;
+
+            if (pTask == nullptr)
+            {
+                std::lock_guard<std::mutex> lock(m_mutexGlobal);
+                if (!m_queGlobal.empty())
+                {
+                    pTask = m_queGlobal.front();
+                    m_queGlobal.pop_front();
+                }
+            }
+
+            if (pTask == nullptr)
+            {
+                // 매번 같은 덱부터 훔치지 않도록 시작 위치를 xorshift로 섞음
+                uint64_t nRandom = context.nRandom != 0 ? context.nRandom : reinterpret_cast<uintptr_t>(&context) | 1;
+                nRandom ^= nRandom << 13;
+                nRandom ^= nRandom >> 7;
+                nRandom ^= nRandom << 17;
+                context.nRandom = nRandom;
+
+                const size_t nQueueCount = m_vQueues.size();
+                const size_t nStart = static_cast<size_t>(nRandom % nQueueCount);
+                for (size_t i = 0; i < nQueueCount && pTask == nullptr; ++i)
+                {
+                    const size_t nVictim = (nStart + i) % nQueueCount;
+                    if (!bIsWorker || nVictim != context.nIdx)
+                    {
+                        pTask = m_vQueues[nVictim]->Steal();
+                    }
+                }
+            }
+
+            if (pTask != nullptr)
+            {
+                m_nQueuedCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return pTask;
+        }
+
+        static void Execute(detail::TaskBase* pTask)
+        {
+            detail::WorkerContext& context = detail::GetWorkerContext();
+            const detail::TaskBase* pPrevTask = context.pCurrentTask;
+            context.pCurrentTask = pTask;
+            try
+            {
+                pTask->Run();
+            }
+            catch (...)
+            {
+                // Submit 작업의 예외는 받을 곳이 없으므로 버림 (Async는 Future로 전달됨)
+            }
+            context.pCurrentTask = pPrevTask;
+            delete pTask;
+        }
+
+        void WorkerLoop(size_t nIdx)
+        {
+            detail::WorkerContext& context = detail::GetWorkerContext();
+            context.pPool = this;
+            context.nIdx = nIdx;
+            context.nRandom = (nIdx + 1) * 0x9E3779B97F4A7C15ull;
+
+            for (;;)
+            {
+                uint32_t nSpinCount = 0;
+                while (nSpinCount < 64)
+                {
+                    if (TryRunOne())
+                    {
+                        nSpinCount = 0;
+                    }
+                    else
+                    {
+                        ++nSpinCount;
+                        std::this_thread::yield();
+                    }
+                }
+
+                std::unique_lock<std::mutex> lock(m_mutexSleep);
+                m_nSleepingCount.fetch_add(1, std::memory_order_seq_cst);
+                m_cvSleep.wait(lock, [this]()
+                    {
+                        return m_bIsStop.load(std::memory_order_seq_cst) ||
+                            m_nQueuedCount.load(std::memory_order_seq_cst) > 0;
+                    });
+                m_nSleepingCount.fetch_sub(1, std::memory_order_relaxed);
+                if (m_bIsStop.load(std::memory_order_relaxed) && m_nQueuedCount.load(std::memory_order_seq_cst) <= 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<detail::WorkStealingDeque<detail::TaskBase*>>> m_vQueues;
+        std::vector<std::thread> m_vWorkers;
+
+        std::mutex m_mutexGlobal;
+        std::deque<detail::TaskBase*> m_queGlobal;
+
+        alignas(64) std::atomic<int64_t> m_nQueuedCount{ 0 };   ///< 넣었지만 아직 아무도 가져가지 않은 작업 수
+        alignas(64) std::atomic<int32_t> m_nSleepingCount{ 0 };
+        std::atomic<bool> m_bIsStop{ false };
+        std::mutex m_mutexSleep;
+        std::condition_variable m_cvSleep;
+    };
+
+    template<typename R>
+    void Future<R>::Wait() const
+    {
+        if (IsReady())
+        {
+            return;
+        }
+
+        if (m_pPool != nullptr && m_pPool->IsWorkerThread())
+        {
+            m_pPool->HelpUntil([this]() { return IsReady(); });
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_pState->mutex);
+        m_pState->cv.wait(lock, [this]() { return m_pState->bIsReady.load(std::memory_order_acquire); });
+    }
+
+    template<typename R>
+    template<typename Func>
+    auto Future<R>::Then(Func&& func) const
+    {
+        using U = typename detail::ThenResult<std::decay_t<Func>, R>::type;
+
+        std::shared_ptr<detail::FutureState<U>> pNextState = std::make_shared<detail::FutureState<U>>();
+        ThreadPool* pPool = m_pPool;
+        std::shared_ptr<detail::FutureState<R>> pState = m_pState;
+        m_pState->AddContinuation(
+            [pPool, pState, pNextState, func = std::forward<Func>(func)]() mutable
+            {
+                pPool->Submit([pState, pNextState, func = std::move(func)]() mutable
+                    {
+                        if (pState->pException)
+                        {
+                            pNextState->SetException(pState->pException);
+                        }
+                        else if constexpr (std::is_void_v<R>)
+                        {
+                            ThreadPool::Fulfill(*pNextState, func);
+                        }
+                        else
+                        {
+                            ThreadPool::Fulfill(*pNextState, func, static_cast<const R&>(*pState->value));
+                        }
+                    });
+            });
+        return Future<U>(std::move(pNextState), m_pPool);
+    }
+} // namespace esk::util_task
\ No newline at end of file
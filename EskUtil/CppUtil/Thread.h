@@ -0,0 +1,50 @@
+﻿/**
+* @file			Thread.h
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		Thread Utility (스레드 CPU 고정)
+*/
+
+#pragma once
+#include "Common.h"
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+#elif __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace esk::gearforge::util::thread
+{
+    /**
+    * @brief        현재 스레드를 CPU 하나에 고정하는 함수
+    * @param[in]    nCpu            CPU 번호 (0부터)
+    * @return       true: 성공, false: 실패 또는 지원하지 않는 플랫폼
+    */
+    inline bool SetCurrentThreadAffinity(uint32_t nCpu)
+    {
+#if defined(_WIN32)
+        if (nCpu >= 64)
+        {
+            return false;
+        }
+        return ::SetThreadAffinityMask(::GetCurrentThread(), static_cast<DWORD_PTR>(1) << nCpu) != 0;
+#elif defined(__linux__)
+        if (nCpu >= CPU_SETSIZE)
+        {
+            return false;
+        }
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(nCpu, &cpuSet);
+        return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+        (void)nCpu;
+        return false;
+#endif
+    }
+} // namespace esk::util_thread
\ No newline at end of file
@@ -1,19 +1,34 @@
 ﻿/**
  * @file	    Time.h
  * @author	    yc.jeon (Eskeptor)
- * @date        2026.04.21
- * @version     0.0.3
+ * @date        2026.10.18
+ * @version     0.0.4
  */
 
 #pragma once
 
+#include "Common.h"
+#include <atomic>
 #include <chrono>
+#include <cstring>
 #include <ctime>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define ESK_TIME_X86
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+        #include <x86intrin.h>
+    #endif
+#endif
 
 namespace esk::gearforge::util::time
 {
     /**
      * @brief       현재 시간을 밀리초 단위로 반환하는 함수
+     * @details     벽시계 시간(system_clock)이므로 NTP 보정 시 되돌아갈 수 있음. 경과 시간 측정은 GetMonotonicNanos 사용
      * @return
      */
     inline uint64_t GetCurrentTimeMillis()
@@ -46,4 +61,389 @@ namespace esk::gearforge::util::time
 #endif
         return true;
     }
+
+
+    /**
+     * @brief       단조 증가 시간을 나노초 단위로 반환하는 함수 (시작 시점은 임의, 경과 시간 측정용)
+     * @details     Linux는 CLOCK_MONOTONIC_RAW (NTP 주파수 보정도 받지 않음), 그 외는 steady_clock (Windows는 QPC 기반)
+     * @return      나노초 단위 시간
+     */
+    inline uint64_t GetMonotonicNanos() noexcept
+    {
+#if defined(__linux__)
+        timespec ts;
+        ::clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+        using namespace std::chrono;
+        return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief       CPU 타임스탬프 카운터를 읽는 함수 (직렬화 없음, 가장 빠름)
+     * @details     x86이 아니면 GetMonotonicNanos 값을 반환 (틱 = 나노초)
+     * @return      틱 값
+     */
+    inline uint64_t ReadTSC() noexcept
+    {
+#if defined(ESK_TIME_X86)
+        return __rdtsc();
+#else
+        return GetMonotonicNanos();
+#endif
+    }
+
+    /**
+     * @brief       rdtscp로 타임스탬프 카운터를 읽는 함수 (앞선 명령이 끝난 뒤 읽음, 측정 구간 끝에 사용)
+     * @param[out]  pAux: IA32_TSC_AUX 값 (대부분 OS에서 CPU 번호, nullptr 가능)
+     * @return      틱 값
+     */
+    inline uint64_t ReadTSCP(uint32_t* pAux = nullptr) noexcept
+    {
+#if defined(ESK_TIME_X86)
+        unsigned int nAux = 0;
+        const uint64_t nTick = __rdtscp(&nAux);
+        if (pAux != nullptr)
+        {
+            *pAux = nAux;
+        }
+        return nTick;
+#else
+        if (pAux != nullptr)
+        {
+            *pAux = 0;
+        }
+        return GetMonotonicNanos();
+#endif
+    }
+
+    /**
+     * @brief       TSC가 코어/전원 상태와 관계없이 일정한 속도로 증가하는지 (invariant TSC) 확인하는 함수
+     * @return      true: invariant TSC, false: 지원 안 함 또는 x86 아님
+     */
+    inline bool IsInvariantTSC() noexcept
+    {
+#if defined(ESK_TIME_X86)
+    #if defined(_MSC_VER)
+        int arrRegs[4] = { 0, };
+        __cpuid(arrRegs, 0x80000000);
+        if (static_cast<unsigned int>(arrRegs[0]) < 0x80000007)
+        {
+            return false;
+        }
+        __cpuid(arrRegs, 0x80000007);
+        return (arrRegs[3] & (1 << 8)) != 0;
+    #else
+        unsigned int nEax = 0;
+        unsigned int nEbx = 0;
+        unsigned int nEcx = 0;
+        unsigned int nEdx = 0;
+        if (__get_cpuid(0x80000007, &nEax, &nEbx, &nEcx, &nEdx) == 0)
+        {
+            return false;
+        }
+        return (nEdx & (1u << 8)) != 0;
+    #endif
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief       TSC 보정 값 (틱 -> 나노초 변환)
+     */
+    struct TSCCalibration
+    {
+        uint64_t nBaseTick = 0;             ///< 보정 시점의 틱
+        uint64_t nBaseNanos = 0;            ///< 보정 시점의 GetMonotonicNanos 값
+        uint64_t nNanosPerTickQ32 = 1ull << 32;    ///< 틱당 나노초 (32비트 고정 소수점)
+        double dTicksPerNanos = 1.0;        ///< 나노초당 틱 (= GHz)
+
+        /**
+         * @brief       틱 구간을 나노초로 변환하는 함수 (곱셈 2번, 나눗셈 없음)
+         */
+        uint64_t TicksToNanos(uint64_t nTicks) const noexcept
+        {
+            return (nTicks >> 32) * nNanosPerTickQ32 + (((nTicks & 0xFFFFFFFFull) * nNanosPerTickQ32) >> 32);
+        }
+
+        /**
+         * @brief       틱 값을 GetMonotonicNanos와 같은 기준의 나노초로 변환하는 함수
+         */
+        uint64_t ToMonotonicNanos(uint64_t nTick) const noexcept
+        {
+            return nTick >= nBaseTick ? nBaseNanos + TicksToNanos(nTick - nBaseTick) : nBaseNanos - TicksToNanos(nBaseTick - nTick);
+        }
+    };
+
+    /**
+     * @brief       nMillis 동안 TSC와 단조 시계를 함께 재서 보정 값을 구하는 함수 (그 시간만큼 대기)
+     * @param[in]   nMillis: 측정 시간 (길수록 정확, 10ms에서 오차 약 0.01%)
+     * @return      보정 값 (x86이 아니면 틱 = 나노초)
+     */
+    inline TSCCalibration CalibrateTSC(uint32_t nMillis = 10)
+    {
+        TSCCalibration calib;
+#if defined(ESK_TIME_X86)
+        // 단조 시계 호출 사이에 끼워 읽어 두 시계의 시점 차이를 최소화
+        auto Sample = [](uint64_t* pTick, uint64_t* pNanos)
+            {
+                uint64_t nBest = UINT64_MAX;
+                for (int i = 0; i < 5; ++i)
+                {
+                    const uint64_t nBefore = GetMonotonicNanos();
+                    const uint64_t nTick = ReadTSCP();
+                    const uint64_t nAfter = GetMonotonicNanos();
+                    if (nAfter - nBefore < nBest)
+                    {
+                        nBest = nAfter - nBefore;
+                        *pTick = nTick;
+                        *pNanos = nBefore + (nAfter - nBefore) / 2;
+                    }
+                }
+            };
+
+        uint64_t nStartTick = 0;
+        uint64_t nStartNanos = 0;
+        Sample(&nStartTick, &nStartNanos);
+        std::this_thread::sleep_for(std::chrono::milliseconds(nMillis));
+        uint64_t nEndTick = 0;
+        uint64_t nEndNanos = 0;
+        Sample(&nEndTick, &nEndNanos);
+
+        const double dNanosPerTick = static_cast<double>(nEndNanos - nStartNanos) / static_cast<double>(nEndTick - nStartTick);
+        calib.nBaseTick = nEndTick;
+        calib.nBaseNanos = nEndNanos;
+        calib.nNanosPerTickQ32 = static_cast<uint64_t>(dNanosPerTick * 4294967296.0 + 0.5);
+        calib.dTicksPerNanos = 1.0 / dNanosPerTick;
+#else
+        (void)nMillis;
+        calib.nBaseTick = GetMonotonicNanos();
+        calib.nBaseNanos = calib.nBaseTick;
+#endif
+        return calib;
+    }
+
+    /**
+     * @brief       프로세스 공용 TSC 보정 값 (첫 호출 시 10ms 동안 보정)
+     */
+    inline const TSCCalibration& GetTSCCalibration()
+    {
+        static const TSCCalibration calib = CalibrateTSC();
+        return calib;
+    }
+
+    /**
+     * @brief       TSC로 단조 시간을 나노초 단위로 반환하는 함수 (시스템 콜/vDSO 없이 약 10ns)
+     * @details     GetMonotonicNanos와 같은 기준. invariant TSC가 아닌 CPU에서는 GetMonotonicNanos를 쓸 것
+     * @return      나노초 단위 시간
+     */
+    inline uint64_t GetTSCNanos()
+    {
+        return GetTSCCalibration().ToMonotonicNanos(ReadTSC());
+    }
+
+    /**
+     * @brief       백그라운드 스레드가 주기적으로 갱신하는 저해상도 단조 시계
+     * @details     읽기는 relaxed atomic load 하나라 매우 싸지만 해상도는 갱신 주기만큼 떨어진다.
+     *              (시간 초과 검사, 캐시 만료처럼 ms 단위면 충분한 초고빈도 경로용)
+     */
+    class CoarseClock
+    {
+    public:
+        /**
+         * @param[in]   resolution: 갱신 주기
+         */
+        explicit CoarseClock(std::chrono::microseconds resolution = std::chrono::milliseconds(1))
+            : m_resolution(resolution)
+        {
+            m_nNanos.store(GetMonotonicNanos(), std::memory_order_relaxed);
+            m_thread = std::thread([this]()
+                {
+                    while (m_bIsRunning.load(std::memory_order_relaxed))
+                    {
+                        std::this_thread::sleep_for(m_resolution);
+                        m_nNanos.store(GetMonotonicNanos(), std::memory_order_relaxed);
+                    }
+                });
+        }
+
+        ~CoarseClock()
+        {
+            m_bIsRunning.store(false, std::memory_order_relaxed);
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        CoarseClock(const CoarseClock&) = delete;
+        CoarseClock& operator=(const CoarseClock&) = delete;
+
+        /**
+         * @brief       마지막으로 갱신된 단조 시간 (GetMonotonicNanos 기준, 최대 갱신 주기만큼 늦음)
+         */
+        uint64_t GetNanos() const noexcept
+        {
+            return m_nNanos.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // 읽는 쪽이 많은 값이므로 다른 멤버와 캐시 라인을 나누지 않음
+        alignas(64) std::atomic<uint64_t> m_nNanos{ 0 };
+        alignas(64) std::atomic<bool> m_bIsRunning{ true };
+        std::chrono::microseconds m_resolution;
+        std::thread m_thread;
+    };
+
+    /**
+     * @brief       저해상도 단조 시간을 나노초 단위로 반환하는 함수 (초고빈도 경로용)
+     * @details     Linux는 CLOCK_MONOTONIC_COARSE (vDSO, 해상도 1~4ms), 그 외는 1ms 주기 공용 CoarseClock
+     *              기준 시점이 GetMonotonicNanos와 다를 수 있으므로 이 함수 값끼리만 비교할 것
+     * @return      나노초 단위 시간
+     */
+    inline uint64_t GetCoarseNanos()
+    {
+#if defined(__linux__)
+        timespec ts;
+        ::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+        static CoarseClock coarseClock;
+        return coarseClock.GetNanos();
+#endif
+    }
+
+
+    /**
+     * @brief       로그용 "YYYY-MM-DD HH:MM:SS.mmm" 시각 문자열 포매터
+     * @details     분이 바뀔 때만 localtime으로 "YYYY-MM-DD HH:MM:" 부분을 다시 만들고, 그 외에는 초/밀리초 5자리만 고쳐 쓴다.
+     *              (시간대 오프셋과 서머타임 전환은 분 단위이므로 같은 분 안에서는 초만 바뀜)
+     *              localtime의 전역 잠금을 피하기 위해 스레드마다 하나씩 쓴다. (GetThreadTimestampFormatter)
+     */
+    class TimestampFormatter
+    {
+    public:
+        static constexpr size_t TEXT_LENGTH = 23;   ///< "YYYY-MM-DD HH:MM:SS.mmm" 길이 ('\0' 제외)
+
+        /**
+         * @param[in]   bIsUTC: true면 UTC, false면 현지 시각
+         */
+        explicit TimestampFormatter(bool bIsUTC = false) noexcept
+            : m_bIsUTC(bIsUTC)
+        {
+        }
+
+        /**
+         * @brief       밀리초 시각을 문자열로 쓰는 함수
+         * @param[in]   nMillis: 1970-01-01 UTC 기준 밀리초 (GetCurrentTimeMillis 값)
+         * @param[out]  pBuffer: 결과 버퍼 (TEXT_LENGTH + 1 바이트면 '\0'까지 씀)
+         * @param[in]   nBufferSize: 버퍼 크기
+         * @return      쓴 글자 수 ('\0' 제외, 버퍼가 TEXT_LENGTH보다 작으면 0)
+         */
+        size_t Format(uint64_t nMillis, char* pBuffer, size_t nBufferSize) noexcept
+        {
+            if (pBuffer == nullptr ||
+                nBufferSize < TEXT_LENGTH)
+            {
+                return 0;
+            }
+
+            const uint64_t nSeconds = nMillis / 1000;
+            const int64_t nTime = static_cast<int64_t>(nSeconds);
+            if (nTime < m_nMinuteStart ||
+                nTime - m_nMinuteStart >= 60)
+            {
+                UpdateMinute(nTime);
+            }
+
+            const uint32_t nSecond = static_cast<uint32_t>(nTime - m_nMinuteStart);
+            const uint32_t nMsec = static_cast<uint32_t>(nMillis - nSeconds * 1000);
+            ::memcpy(m_arrText + 17, DIGIT_PAIRS + nSecond * 2, 2);
+            m_arrText[20] = static_cast<char>('0' + nMsec / 100);
+            ::memcpy(m_arrText + 21, DIGIT_PAIRS + (nMsec % 100) * 2, 2);
+
+            ::memcpy(pBuffer, m_arrText, nBufferSize > TEXT_LENGTH ? TEXT_LENGTH + 1 : TEXT_LENGTH);
+            return TEXT_LENGTH;
+        }
+
+        /**
+         * @brief       현재 시각을 문자열로 쓰는 함수
+         */
+        size_t FormatNow(char* pBuffer, size_t nBufferSize) noexcept
+        {
+            return Format(GetCurrentTimeMillis(), pBuffer, nBufferSize);
+        }
+
+    private:
+        static constexpr char DIGIT_PAIRS[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        /**
+         * @brief       분이 바뀌었을 때 "YYYY-MM-DD HH:MM:" 부분을 다시 만드는 함수
+         * @details     캐시 구간은 UTC 분이 아니라 변환된 시각의 분 기준이다.
+         *              (UTC 오프셋이 분 단위로 떨어지지 않는 시간대, 예) 1972년 이전 Africa/Monrovia -0:44:30)
+         */
+        void UpdateMinute(int64_t nSeconds) noexcept
+        {
+            std::time_t nTime = static_cast<std::time_t>(nSeconds);
+            std::tm tmTime = {};
+#ifdef _WIN32
+            if (m_bIsUTC)
+            {
+                gmtime_s(&tmTime, &nTime);
+            }
+            else
+            {
+                localtime_s(&tmTime, &nTime);
+            }
+#else
+            if (m_bIsUTC)
+            {
+                gmtime_r(&nTime, &tmTime);
+            }
+            else
+            {
+                localtime_r(&nTime, &tmTime);
+            }
+#endif
+            int nYear = tmTime.tm_year + 1900;
+            nYear = nYear < 0 ? 0 : (nYear > 9999 ? 9999 : nYear);
+            ::memcpy(m_arrText + 0, DIGIT_PAIRS + (nYear / 100) * 2, 2);
+            ::memcpy(m_arrText + 2, DIGIT_PAIRS + (nYear % 100) * 2, 2);
+            ::memcpy(m_arrText + 5, DIGIT_PAIRS + (tmTime.tm_mon + 1) * 2, 2);
+            ::memcpy(m_arrText + 8, DIGIT_PAIRS + tmTime.tm_mday * 2, 2);
+            ::memcpy(m_arrText + 11, DIGIT_PAIRS + tmTime.tm_hour * 2, 2);
+            ::memcpy(m_arrText + 14, DIGIT_PAIRS + tmTime.tm_min * 2, 2);
+            m_nMinuteStart = nSeconds - (tmTime.tm_sec > 59 ? 59 : tmTime.tm_sec);
+        }
+
+        int64_t m_nMinuteStart = INT64_MAX;     ///< 캐시된 분이 시작하는 UTC 초
+        char m_arrText[TEXT_LENGTH + 1] = "0000-00-00 00:00:00.000";
+        bool m_bIsUTC;
+    };
+
+    /**
+     * @brief       현재 스레드 전용 현지 시각 포매터
+     */
+    inline TimestampFormatter& GetThreadTimestampFormatter() noexcept
+    {
+        thread_local TimestampFormatter formatter;
+        return formatter;
+    }
+
+    /**
+     * @brief       밀리초 시각을 "YYYY-MM-DD HH:MM:SS.mmm" (현지 시각)으로 쓰는 함수 (스레드별 캐시 사용)
+     * @param[in]   nMillis: 1970-01-01 UTC 기준 밀리초 (GetCurrentTimeMillis 값)
+     * @param[out]  pBuffer: 결과 버퍼 (24바이트면 '\0'까지 씀)
+     * @param[in]   nBufferSize: 버퍼 크기
+     * @return      쓴 글자 수 (버퍼가 23바이트보다 작으면 0)
+     */
+    inline size_t FormatTimestamp(uint64_t nMillis, char* pBuffer, size_t nBufferSize) noexcept
+    {
+        return GetThreadTimestampFormatter().Format(nMillis, pBuffer, nBufferSize);
+    }
 }
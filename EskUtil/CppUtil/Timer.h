@@ -0,0 +1,842 @@
+﻿/**
+* @file			Timer.h
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		Timer Utility (계층형 타이머 휠, 고정 주기 실행기)
+*/
+
+#pragma once
+#include "Common.h"
+#include "Profile.h"
+#include "Thread.h"
+#include "Time.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace esk::gearforge::util::timer
+{
+    /**
+    * @brief        TimerWheel 통계 (지연 = 콜백 시작 시각 - 요청한 시각, 나노초)
+    */
+    struct TimerStats
+    {
+        uint64_t nActiveCount = 0;          ///< 등록되어 있는 타이머 수
+        uint64_t nFiredCount = 0;           ///< 실행된 콜백 수
+        uint64_t nCancelledCount = 0;       ///< 취소된 타이머 수
+        uint64_t nSkippedCount = 0;         ///< 이전 콜백이 아직 실행 중이라 건너뛴 주기 수
+        uint64_t nMissedCount = 0;          ///< 드라이버가 늦어 지나가 버린 주기 수
+        double dMeanLateNanos = 0.0;        ///< 평균 지연 (drift)
+        uint64_t nP50LateNanos = 0;         ///< 지연 분포 (jitter)
+        uint64_t nP99LateNanos = 0;
+        uint64_t nP999LateNanos = 0;
+        uint64_t nMaxLateNanos = 0;
+    };
+
+    /**
+    * @brief        계층형 해시 타이머 휠 (드라이버 스레드 1개 + 작업 스레드 풀)
+    * @details      256칸 x 4단계 휠에 타이머를 넣고, 드라이버 스레드가 틱마다 0단계 칸을 비운다.
+    *               상위 단계 칸은 하위 단계가 한 바퀴 돌 때 아래로 내려온다. (2^32 틱 이상은 최상위 마지막 칸에서 대기)
+    *               각 칸은 노드 번호로 연결한 이중 연결 리스트라 추가/취소 모두 O(1)이며 잠금 하나 안에서 끝난다.
+    *               만료된 콜백은 작업 스레드로 넘기며(nWorkerCount가 0이면 드라이버 스레드에서 실행),
+    *               주기 타이머는 EskTimer처럼 이전 콜백이 끝나지 않았으면 그 주기를 건너뛴다.
+    *               주기 타이머의 다음 시각은 "이전 예정 시각 + 주기"로 잡으므로 오차가 누적되지 않는다.
+    *               시간 기준은 GetMonotonicNanos이며 생성 시점이 0틱이다.
+    */
+    class TimerWheel
+    {
+    public:
+        using TimerId = uint64_t;
+        using Callback = std::function<void()>;
+
+        static constexpr TimerId INVALID_TIMER_ID = 0;
+
+        /**
+        * @param[in]    tick            틱 간격 (해상도, 1us 이상)
+        * @param[in]    nWorkerCount    콜백을 실행할 작업 스레드 수 (0이면 드라이버 스레드에서 직접 실행)
+        * @exception    std::invalid_argument   tick이 1us 미만인 경우
+        */
+        explicit TimerWheel(std::chrono::nanoseconds tick = std::chrono::milliseconds(1), size_t nWorkerCount = 1)
+            : m_nTickNanos(static_cast<uint64_t>(tick.count()))
+            , m_nWorkerCount(nWorkerCount)
+            , m_nStartNanos(time::GetMonotonicNanos())
+        {
+            if (tick < std::chrono::microseconds(1))
+            {
+                throw std::invalid_argument("TimerWheel tick must be at least 1us");
+            }
+
+            for (uint32_t& nHead : m_arrSlots)
+            {
+                nHead = NIL;
+            }
+            // 작업 스레드마다 하나, 드라이버 스레드 직접 실행용 하나 (단일 작성자 히스토그램)
+            for (size_t i = 0; i <= m_nWorkerCount; ++i)
+            {
+                m_vLateHistograms.push_back(std::make_unique<profile::LatencyHistogram>());
+            }
+        }
+
+        ~TimerWheel()
+        {
+            Stop();
+        }
+
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        /**
+        * @brief        드라이버/작업 스레드 시작
+        * @return       true: 시작, false: 이미 실행 중
+        */
+        bool Start()
+        {
+            // 콜백 안에서는 자기 스레드를 join할 수 없으므로 재시작 불가
+            if (IsOwnThread())
+            {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutexControl);
+            if (m_bIsRunning.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            JoinThreads();
+
+            m_bIsWorkerStop = false;
+            m_bIsRunning.store(true, std::memory_order_release);
+            for (size_t i = 0; i < m_nWorkerCount; ++i)
+            {
+                m_vWorkers.emplace_back([this, i]() { WorkerLoop(i); });
+            }
+            m_driver = std::thread([this]() { DriverLoop(); });
+            return true;
+        }
+
+        /**
+        * @brief        스레드 종료 (이미 넘긴 콜백은 모두 실행한 뒤 종료, 등록된 타이머는 유지)
+        * @details      콜백 안에서 호출하면 종료 신호만 보내고 바로 반환하며, 스레드 join은 다음 Start/Stop 또는 소멸자에서 한다.
+        */
+        void Stop()
+        {
+            if (m_bIsRunning.exchange(false))
+            {
+                std::lock_guard<std::mutex> lock(m_mutexDriver);
+                m_cvDriver.notify_all();
+            }
+            if (IsOwnThread())
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutexControl);
+            JoinThreads();
+        }
+
+        /**
+        * @brief        한 번만 실행되는 타이머 추가
+        * @param[in]    delay           지금부터의 지연 (틱 단위로 올림)
+        * @param[in]    func            콜백
+        * @return       타이머 ID (Cancel에 사용)
+        */
+        TimerId AddOneShot(std::chrono::nanoseconds delay, Callback func)
+        {
+            return Add(delay, std::chrono::nanoseconds(0), std::move(func));
+        }
+
+        /**
+        * @brief        주기 타이머 추가
+        * @param[in]    period          주기 (0보다 커야 함)
+        * @param[in]    func            콜백
+        * @param[in]    firstDelay      첫 실행까지의 지연 (음수면 period)
+        * @return       타이머 ID (period가 0 이하이면 INVALID_TIMER_ID)
+        */
+        TimerId AddPeriodic(std::chrono::nanoseconds period, Callback func, std::chrono::nanoseconds firstDelay = std::chrono::nanoseconds(-1))
+        {
+            if (period.count() <= 0)
+            {
+                return INVALID_TIMER_ID;
+            }
+            return Add(firstDelay.count() < 0 ? period : firstDelay, period, std::move(func));
+        }
+
+        /**
+        * @brief        타이머 취소 (이미 작업 스레드로 넘어간 실행분은 취소되지 않음)
+        * @return       true: 취소, false: 없거나 이미 만료된 타이머
+        */
+        bool Cancel(TimerId nId)
+        {
+            const uint32_t nIdx = static_cast<uint32_t>(nId & 0xFFFFFFFFull);
+            const uint32_t nGeneration = static_cast<uint32_t>(nId >> 32);
+
+            std::lock_guard<std::mutex> lock(m_mutexWheel);
+            if (nIdx >= m_vNodes.size() ||
+                m_vNodes[nIdx].nGeneration != nGeneration ||
+                !m_vNodes[nIdx].bIsActive)
+            {
+                return false;
+            }
+
+            Unlink(nIdx);
+            FreeNode(nIdx);
+            m_nCancelledCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        size_t GetActiveCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutexWheel);
+            return m_nActiveCount;
+        }
+
+        /**
+        * @brief        통계 (실행 중에도 호출 가능)
+        */
+        TimerStats GetStats() const
+        {
+            TimerStats stats;
+            stats.nActiveCount = GetActiveCount();
+            stats.nFiredCount = m_nFiredCount.load(std::memory_order_relaxed);
+            stats.nCancelledCount = m_nCancelledCount.load(std::memory_order_relaxed);
+            stats.nSkippedCount = m_nSkippedCount.load(std::memory_order_relaxed);
+            stats.nMissedCount = m_nMissedCount.load(std::memory_order_relaxed);
+
+            std::unique_ptr<profile::LatencyHistogram> pMerged = std::make_unique<profile::LatencyHistogram>();
+            for (const std::unique_ptr<profile::LatencyHistogram>& pHistogram : m_vLateHistograms)
+            {
+                pMerged->Merge(*pHistogram);
+            }
+            if (pMerged->GetCount() > 0)
+            {
+                stats.dMeanLateNanos = static_cast<double>(pMerged->GetSum()) / static_cast<double>(pMerged->GetCount());
+            }
+            stats.nP50LateNanos = pMerged->GetPercentile(50.0);
+            stats.nP99LateNanos = pMerged->GetPercentile(99.0);
+            stats.nP999LateNanos = pMerged->GetPercentile(99.9);
+            stats.nMaxLateNanos = pMerged->GetMax();
+            return stats;
+        }
+
+    private:
+        static constexpr uint32_t NIL = UINT32_MAX;
+        static constexpr uint32_t LEVEL_BITS = 8;
+        static constexpr uint32_t SLOT_COUNT = 1u << LEVEL_BITS;
+        static constexpr uint32_t LEVEL_COUNT = 4;
+
+        /**
+        * @brief        콜백과 실행 중 여부 (주기 타이머는 여러 번 공유)
+        */
+        struct TimerTask
+        {
+            Callback func;
+            std::atomic<bool> bIsRunning{ false };
+        };
+
+        struct Node
+        {
+            std::shared_ptr<TimerTask> pTask;
+            uint64_t nDueNanos = 0;             ///< 요청한 실행 시각 (GetMonotonicNanos 기준)
+            uint64_t nPeriodNanos = 0;          ///< 0이면 한 번만
+            uint64_t nDeadlineTick = 0;
+            uint32_t nPrev = NIL;
+            uint32_t nNext = NIL;
+            uint32_t nSlot = NIL;               ///< 단계 * SLOT_COUNT + 칸
+            uint32_t nGeneration = 1;
+            bool bIsActive = false;
+        };
+
+        struct Job
+        {
+            std::shared_ptr<TimerTask> pTask;
+            uint64_t nDueNanos;
+        };
+
+        TimerId Add(std::chrono::nanoseconds delay, std::chrono::nanoseconds period, Callback func)
+        {
+            std::shared_ptr<TimerTask> pTask = std::make_shared<TimerTask>();
+            pTask->func = std::move(func);
+            const uint64_t nDue = time::GetMonotonicNanos() + static_cast<uint64_t>(std::max<int64_t>(delay.count(), 0));
+
+            std::lock_guard<std::mutex> lock(m_mutexWheel);
+            uint32_t nIdx = 0;
+            if (m_nFreeHead != NIL)
+            {
+                nIdx = m_nFreeHead;
+                m_nFreeHead = m_vNodes[nIdx].nNext;
+            }
+            else
+            {
+                nIdx = static_cast<uint32_t>(m_vNodes.size());
+                m_vNodes.emplace_back();
+            }
+
+            Node& node = m_vNodes[nIdx];
+            node.pTask = std::move(pTask);
+            node.nDueNanos = nDue;
+            node.nPeriodNanos = static_cast<uint64_t>(period.count());
+            node.bIsActive = true;
+            ++m_nActiveCount;
+            Schedule(nIdx);
+            return (static_cast<uint64_t>(node.nGeneration) << 32) | nIdx;
+        }
+
+        /**
+        * @brief        nDueNanos로 마감 틱을 구해 휠에 넣는 함수 (이미 지난 시각은 다음 틱)
+        */
+        void Schedule(uint32_t nIdx)
+        {
+            Node& node = m_vNodes[nIdx];
+            const uint64_t nOffset = node.nDueNanos > m_nStartNanos ? node.nDueNanos - m_nStartNanos : 0;
+            node.nDeadlineTick = (std::max)((nOffset + m_nTickNanos - 1) / m_nTickNanos, m_nCurrentTick + 1);
+            Place(nIdx);
+        }
+
+        /**
+        * @brief        남은 틱 수에 맞는 단계/칸에 노드를 연결하는 함수 (마감 틱이 지금이면 만료 목록으로)
+        */
+        void Place(uint32_t nIdx)
+        {
+            Node& node = m_vNodes[nIdx];
+            if (node.nDeadlineTick <= m_nCurrentTick)
+            {
+                m_vExpiredNodes.push_back(nIdx);
+                node.nSlot = NIL;
+                return;
+            }
+
+            const uint64_t nDelta = node.nDeadlineTick - m_nCurrentTick;
+            uint32_t nLevel = 0;
+            while (nLevel + 1 < LEVEL_COUNT &&
+                nDelta >= (1ull << (LEVEL_BITS * (nLevel + 1))))
+            {
+                ++nLevel;
+            }
+
+            uint64_t nSlotTick = node.nDeadlineTick;
+            if (nDelta >= (1ull << (LEVEL_BITS * LEVEL_COUNT)))
+            {
+                // 휠 범위 밖은 최상위의 가장 먼 칸에서 기다렸다가 내려올 때 다시 계산
+                nSlotTick = m_nCurrentTick + (1ull << (LEVEL_BITS * LEVEL_COUNT)) - 1;
+            }
+            const uint32_t nSlot = nLevel * SLOT_COUNT + static_cast<uint32_t>((nSlotTick >> (LEVEL_BITS * nLevel)) & (SLOT_COUNT - 1));
+
+            node.nSlot = nSlot;
+            node.nPrev = NIL;
+            node.nNext = m_arrSlots[nSlot];
+            if (node.nNext != NIL)
+            {
+                m_vNodes[node.nNext].nPrev = nIdx;
+            }
+            m_arrSlots[nSlot] = nIdx;
+        }
+
+        void Unlink(uint32_t nIdx)
+        {
+            Node& node = m_vNodes[nIdx];
+            if (node.nSlot == NIL)
+            {
+                return;
+            }
+            if (node.nPrev != NIL)
+            {
+                m_vNodes[node.nPrev].nNext = node.nNext;
+            }
+            else
+            {
+                m_arrSlots[node.nSlot] = node.nNext;
+            }
+            if (node.nNext != NIL)
+            {
+                m_vNodes[node.nNext].nPrev = node.nPrev;
+            }
+            node.nSlot = NIL;
+        }
+
+        void FreeNode(uint32_t nIdx)
+        {
+            Node& node = m_vNodes[nIdx];
+            node.pTask.reset();
+            node.bIsActive = false;
+            ++node.nGeneration;
+            node.nNext = m_nFreeHead;
+            m_nFreeHead = nIdx;
+            --m_nActiveCount;
+        }
+
+        /**
+        * @brief        칸의 노드를 모두 떼어 다시 배치하는 함수 (하위 단계로 내려오거나 만료)
+        */
+        void FlushSlot(uint32_t nSlot)
+        {
+            uint32_t nIdx = m_arrSlots[nSlot];
+            m_arrSlots[nSlot] = NIL;
+            while (nIdx != NIL)
+            {
+                const uint32_t nNext = m_vNodes[nIdx].nNext;
+                Place(nIdx);
+                nIdx = nNext;
+            }
+        }
+
+        /**
+        * @brief        한 틱 진행 (상위 단계부터 내려온 뒤 0단계 칸 처리)
+        */
+        void ProcessTick(uint64_t nTick, uint64_t nNowNanos, std::vector<Job>* pJobs)
+        {
+            m_nCurrentTick = nTick;
+            for (uint32_t nLevel = LEVEL_COUNT - 1; nLevel > 0; --nLevel)
+            {
+                if ((nTick & ((1ull << (LEVEL_BITS * nLevel)) - 1)) == 0)
+                {
+                    FlushSlot(nLevel * SLOT_COUNT + static_cast<uint32_t>((nTick >> (LEVEL_BITS * nLevel)) & (SLOT_COUNT - 1)));
+                }
+            }
+            FlushSlot(static_cast<uint32_t>(nTick & (SLOT_COUNT - 1)));
+
+            for (uint32_t nIdx : m_vExpiredNodes)
+            {
+                Node& node = m_vNodes[nIdx];
+                pJobs->push_back(Job{ node.pTask, node.nDueNanos });
+                if (node.nPeriodNanos == 0)
+                {
+                    FreeNode(nIdx);
+                    continue;
+                }
+
+                node.nDueNanos += node.nPeriodNanos;
+                if (node.nDueNanos <= nNowNanos)
+                {
+                    // 드라이버가 늦은 만큼의 주기는 몰아서 실행하지 않고 건너뜀
+                    const uint64_t nMissed = (nNowNanos - node.nDueNanos) / node.nPeriodNanos + 1;
+                    node.nDueNanos += nMissed * node.nPeriodNanos;
+                    m_nMissedCount.fetch_add(nMissed, std::memory_order_relaxed);
+                }
+                Schedule(nIdx);
+            }
+            m_vExpiredNodes.clear();
+        }
+
+        void Dispatch(std::vector<Job>* pJobs)
+        {
+            if (pJobs->empty())
+            {
+                return;
+            }
+
+            if (m_nWorkerCount == 0)
+            {
+                for (Job& job : *pJobs)
+                {
+                    if (TryAcquire(job))
+                    {
+                        RunJob(job, m_nWorkerCount);
+                    }
+                }
+            }
+            else
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutexQueue);
+                    for (Job& job : *pJobs)
+                    {
+                        if (TryAcquire(job))
+                        {
+                            m_queJobs.push_back(std::move(job));
+                        }
+                    }
+                }
+                m_cvQueue.notify_all();
+            }
+            pJobs->clear();
+        }
+
+        bool TryAcquire(const Job& job)
+        {
+            if (job.pTask->bIsRunning.exchange(true, std::memory_order_acq_rel))
+            {
+                m_nSkippedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        void RunJob(const Job& job, size_t nHistogramIdx)
+        {
+            const uint64_t nStart = time::GetMonotonicNanos();
+            m_vLateHistograms[nHistogramIdx]->Record(nStart > job.nDueNanos ? nStart - job.nDueNanos : 0);
+            try
+            {
+                job.pTask->func();
+            }
+            catch (...)
+            {
+                // 콜백 예외로 드라이버/작업 스레드가 죽지 않도록 무시
+            }
+            job.pTask->bIsRunning.store(false, std::memory_order_release);
+            m_nFiredCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief        현재 스레드가 실행 중인 TimerWheel (드라이버/작업 스레드가 아니면 nullptr)
+        */
+        static const TimerWheel*& GetCurrentWheel() noexcept
+        {
+            thread_local const TimerWheel* pWheel = nullptr;
+            return pWheel;
+        }
+
+        bool IsOwnThread() const noexcept
+        {
+            return GetCurrentWheel() == this;
+        }
+
+        /**
+        * @brief        드라이버/작업 스레드 join (m_mutexControl을 잡고 호출, 작업 스레드 종료는 드라이버가 끝나면서 알림)
+        */
+        void JoinThreads()
+        {
+            if (m_driver.joinable())
+            {
+                m_driver.join();
+            }
+            for (std::thread& worker : m_vWorkers)
+            {
+                worker.join();
+            }
+            m_vWorkers.clear();
+        }
+
+        void DriverLoop()
+        {
+            GetCurrentWheel() = this;
+            std::vector<Job> vJobs;
+            while (m_bIsRunning.load(std::memory_order_acquire))
+            {
+                const uint64_t nNow = time::GetMonotonicNanos();
+                const uint64_t nNowTick = (nNow - m_nStartNanos) / m_nTickNanos;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutexWheel);
+                    if (m_nActiveCount == 0)
+                    {
+                        m_nCurrentTick = (std::max)(m_nCurrentTick, nNowTick);
+                    }
+                    while (m_nCurrentTick < nNowTick)
+                    {
+                        ProcessTick(m_nCurrentTick + 1, nNow, &vJobs);
+                    }
+                }
+                Dispatch(&vJobs);
+
+                const uint64_t nNextNanos = m_nStartNanos + (nNowTick + 1) * m_nTickNanos;
+                const uint64_t nAfter = time::GetMonotonicNanos();
+                if (nNextNanos > nAfter)
+                {
+                    std::unique_lock<std::mutex> lock(m_mutexDriver);
+                    m_cvDriver.wait_for(lock, std::chrono::nanoseconds(nNextNanos - nAfter),
+                        [this]() { return !m_bIsRunning.load(std::memory_order_acquire); });
+                }
+            }
+
+            // 더 넘길 콜백이 없으므로 작업 스레드는 큐를 비운 뒤 종료
+            {
+                std::lock_guard<std::mutex> lock(m_mutexQueue);
+                m_bIsWorkerStop = true;
+            }
+            m_cvQueue.notify_all();
+        }
+
+        void WorkerLoop(size_t nWorkerIdx)
+        {
+            GetCurrentWheel() = this;
+            for (;;)
+            {
+                Job job;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutexQueue);
+                    m_cvQueue.wait(lock, [this]() { return m_bIsWorkerStop || !m_queJobs.empty(); });
+                    if (m_queJobs.empty())
+                    {
+                        return;
+                    }
+                    job = std::move(m_queJobs.front());
+                    m_queJobs.pop_front();
+                }
+                RunJob(job, nWorkerIdx);
+            }
+        }
+
+        const uint64_t m_nTickNanos;
+        const size_t m_nWorkerCount;
+        const uint64_t m_nStartNanos;
+
+        mutable std::mutex m_mutexWheel;
+        std::vector<Node> m_vNodes;
+        uint32_t m_arrSlots[LEVEL_COUNT * SLOT_COUNT];
+        uint32_t m_nFreeHead = NIL;
+        uint64_t m_nCurrentTick = 0;
+        size_t m_nActiveCount = 0;
+        std::vector<uint32_t> m_vExpiredNodes;
+
+        std::mutex m_mutexControl;              ///< Start/Stop의 join 직렬화 (콜백 안의 Stop은 잡지 않음)
+        std::atomic<bool> m_bIsRunning{ false };
+        std::thread m_driver;
+        std::mutex m_mutexDriver;
+        std::condition_variable m_cvDriver;
+
+        std::mutex m_mutexQueue;
+        std::condition_variable m_cvQueue;
+        std::deque<Job> m_queJobs;
+        bool m_bIsWorkerStop = false;
+        std::vector<std::thread> m_vWorkers;
+
+        std::vector<std::unique_ptr<profile::LatencyHistogram>> m_vLateHistograms;
+        std::atomic<uint64_t> m_nFiredCount{ 0 };
+        std::atomic<uint64_t> m_nCancelledCount{ 0 };
+        std::atomic<uint64_t> m_nSkippedCount{ 0 };
+        std::atomic<uint64_t> m_nMissedCount{ 0 };
+    };
+
+    /**
+    * @brief        고정 주기 실행기 (1~10kHz 제어 루프용)
+    * @details      k번째 실행 시각을 "시작 시각 + k * 주기"로 고정하고 그 시각까지 절대 시각으로 잠든다.
+    *               (Linux는 CLOCK_MONOTONIC + clock_nanosleep(TIMER_ABSTIME), 그 외는 steady_clock::sleep_until)
+    *               잠에서 깨는 오차를 줄이려면 spinWindow를 주어 마감 직전 구간은 바쁜 대기로 맞춘다.
+    *               콜백이 다음 마감을 넘기면 초과 시간을 기록하고, 통째로 지나간 주기는 건너뛰어 위상을 유지한다.
+    *               히스토그램은 실행 스레드만 쓰므로 다른 스레드에서 실행 중에 읽어도 된다.
+    *               Windows는 timeBeginPeriod(1) 없이 잠들면 오차가 15ms까지 커지므로 spinWindow를 넉넉히 줄 것.
+    */
+    class PeriodicExecutor
+    {
+    public:
+        using Callback = std::function<void()>;
+
+        static constexpr int32_t NO_AFFINITY = -1;
+
+        /**
+        * @param[in]    period          실행 주기
+        * @param[in]    spinWindow      마감 직전 바쁜 대기 구간 (0이면 잠들기만 함)
+        * @param[in]    nCpu            실행 스레드를 고정할 CPU (NO_AFFINITY이면 고정하지 않음)
+        * @exception    std::invalid_argument   period가 0 이하이거나 spinWindow가 음수 또는 period 이상인 경우
+        */
+        explicit PeriodicExecutor(std::chrono::nanoseconds period,
+            std::chrono::nanoseconds spinWindow = std::chrono::nanoseconds(0),
+            int32_t nCpu = NO_AFFINITY)
+            : m_nPeriodNanos(static_cast<uint64_t>(period.count()))
+            , m_nSpinNanos(static_cast<uint64_t>(spinWindow.count()))
+            , m_nCpu(nCpu)
+            , m_pJitter(std::make_unique<profile::LatencyHistogram>())
+            , m_pOverrun(std::make_unique<profile::LatencyHistogram>())
+        {
+            if (period.count() <= 0 || spinWindow.count() < 0 || spinWindow >= period)
+            {
+                throw std::invalid_argument("PeriodicExecutor requires period > 0 and 0 <= spinWindow < period");
+            }
+        }
+
+        ~PeriodicExecutor()
+        {
+            Stop();
+        }
+
+        PeriodicExecutor(const PeriodicExecutor&) = delete;
+        PeriodicExecutor& operator=(const PeriodicExecutor&) = delete;
+
+        /**
+        * @brief        실행 스레드 시작 (첫 실행은 한 주기 뒤)
+        * @details      콜백 안에서 Stop한 이전 실행이 남아 있으면 그 스레드가 끝날 때까지 기다린 뒤 시작한다.
+        * @return       true: 시작, false: 이미 실행 중이거나 콜백 안에서 호출
+        */
+        bool Start(Callback func)
+        {
+            if (m_runThreadId.load(std::memory_order_acquire) == std::this_thread::get_id())
+            {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutexControl);
+            if (m_bIsRunning.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            // 이전 루프는 종료 요청을 이미 보았으므로 곧 끝남 (플래그를 다시 켜기 전에 반드시 기다려야 함)
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+
+            m_func = std::move(func);
+            m_bIsRunning.store(true, std::memory_order_release);
+            m_thread = std::thread([this]() { Run(); });
+            return true;
+        }
+
+        /**
+        * @brief        실행 종료 (진행 중인 주기가 끝날 때까지 대기, 콜백 안에서 부르면 종료 요청만 함)
+        */
+        void Stop()
+        {
+            m_bIsRunning.store(false, std::memory_order_release);
+            if (m_runThreadId.load(std::memory_order_acquire) == std::this_thread::get_id())
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutexControl);
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        bool IsRunning() const noexcept
+        {
+            return m_bIsRunning.load(std::memory_order_acquire);
+        }
+
+        /**
+        * @brief        CPU 고정 성공 여부 (NO_AFFINITY이거나 아직 시작 전이면 false)
+        */
+        bool IsPinned() const noexcept
+        {
+            return m_bIsPinned.load(std::memory_order_relaxed);
+        }
+
+        uint64_t GetCycleCount() const noexcept
+        {
+            return m_nCycleCount.load(std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief        콜백이 길어져 건너뛴 주기 수
+        */
+        uint64_t GetMissedCount() const noexcept
+        {
+            return m_nMissedCount.load(std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief        주기마다 깨어난 시각 - 예정 시각 (나노초)
+        */
+        const profile::LatencyHistogram& GetJitterHistogram() const noexcept
+        {
+            return *m_pJitter;
+        }
+
+        /**
+        * @brief        콜백 종료 시각 - 다음 예정 시각 (나노초, 초과한 주기만 기록)
+        */
+        const profile::LatencyHistogram& GetOverrunHistogram() const noexcept
+        {
+            return *m_pOverrun;
+        }
+
+    private:
+        /**
+        * @brief        절대 시각 잠들기와 같은 시계의 현재 시각 (나노초)
+        */
+        static uint64_t NowNanos() noexcept
+        {
+#if defined(__linux__)
+            timespec ts;
+            ::clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+            return time::GetMonotonicNanos();
+#endif
+        }
+
+        static void SleepUntil(uint64_t nNanos)
+        {
+#if defined(__linux__)
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(nNanos / 1000000000ull);
+            ts.tv_nsec = static_cast<long>(nNanos % 1000000000ull);
+            while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+            {
+            }
+#else
+            std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(nNanos)));
+#endif
+        }
+
+        void WaitUntil(uint64_t nDeadline) const
+        {
+            if (nDeadline > NowNanos() + m_nSpinNanos)
+            {
+                SleepUntil(nDeadline - m_nSpinNanos);
+            }
+            while (NowNanos() < nDeadline)
+            {
+#if defined(ESK_TIME_X86)
+                _mm_pause();
+#endif
+            }
+        }
+
+        void Run()
+        {
+            m_runThreadId.store(std::this_thread::get_id(), std::memory_order_release);
+            if (m_nCpu >= 0)
+            {
+                m_bIsPinned.store(thread::SetCurrentThreadAffinity(static_cast<uint32_t>(m_nCpu)), std::memory_order_relaxed);
+            }
+
+            uint64_t nDeadline = NowNanos() + m_nPeriodNanos;
+            while (m_bIsRunning.load(std::memory_order_acquire))
+            {
+                WaitUntil(nDeadline);
+                const uint64_t nWake = NowNanos();
+                m_pJitter->Record(nWake > nDeadline ? nWake - nDeadline : 0);
+
+                try
+                {
+                    m_func();
+                }
+                catch (...)
+                {
+                    // 한 주기의 실패로 루프 전체를 멈추지 않음
+                }
+                m_nCycleCount.fetch_add(1, std::memory_order_relaxed);
+
+                const uint64_t nEnd = NowNanos();
+                nDeadline += m_nPeriodNanos;
+                if (nEnd > nDeadline)
+                {
+                    // 다음 주기는 바로 실행하되, 그 뒤로 통째로 지나간 주기는 건너뛰어 시작 시각 격자에 맞춤
+                    const uint64_t nOverrun = nEnd - nDeadline;
+                    const uint64_t nMissed = nOverrun / m_nPeriodNanos;
+                    m_pOverrun->Record(nOverrun);
+                    nDeadline += nMissed * m_nPeriodNanos;
+                    m_nMissedCount.fetch_add(nMissed, std::memory_order_relaxed);
+                }
+            }
+            m_runThreadId.store(std::thread::id(), std::memory_order_release);
+        }
+
+        const uint64_t m_nPeriodNanos;
+        const uint64_t m_nSpinNanos;
+        const int32_t m_nCpu;
+
+        Callback m_func;
+        std::mutex m_mutexControl;      ///< Start/Stop 직렬화 (콜백 안의 Stop은 잡지 않음)
+        std::thread m_thread;
+        std::atomic<std::thread::id> m_runThreadId;
+        std::atomic<bool> m_bIsRunning{ false };
+        std::atomic<bool> m_bIsPinned{ false };
+        std::atomic<uint64_t> m_nCycleCount{ 0 };
+        std::atomic<uint64_t> m_nMissedCount{ 0 };
+        std::unique_ptr<profile::LatencyHistogram> m_pJitter;
+        std::unique_ptr<profile::LatencyHistogram> m_pOverrun;
+    };
+} // namespace esk::util_timer
\ No newline at end of file
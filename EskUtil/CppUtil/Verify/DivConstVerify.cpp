@@ -0,0 +1,98 @@
+﻿/**
+* @file			DivConstVerify.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		DivConst / Div10 / Div100 / Div1000 전체 32비트 범위 검증 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		모든 int32_t 입력(2^32개)에 대해 스칼라 함수와 배열 함수(AVX2/NEON 경로 포함)가 '/' 연산과 같은지 확인한다.
+*				빌드 예)
+*				g++ -std=c++20 -O2 -I.. DivConstVerify.cpp -o DivConstVerify            (스칼라 경로)
+*				g++ -std=c++20 -O2 -mavx2 -I.. DivConstVerify.cpp -o DivConstVerify     (AVX2 경로)
+*				cl /std:c++20 /O2 /arch:AVX2 /I.. DivConstVerify.cpp
+*				실패가 없으면 0을 반환
+*/
+
+#include "Calculate.h"
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    constexpr size_t CHUNK_SIZE = static_cast<size_t>(1) << 20;
+
+    /**
+    * @brief        scalar / batch 함수로 전체 int32_t 범위를 나눠 '/' 결과와 비교하는 함수
+    * @return       틀린 입력 수
+    */
+    template <int64_t N, typename ScalarFunc, typename BatchFunc>
+    uint64_t VerifyAll(const char* pszName, ScalarFunc scalar, BatchFunc batch)
+    {
+        std::vector<int32_t> vSrc(CHUNK_SIZE);
+        std::vector<int32_t> vDst(CHUNK_SIZE);
+        uint64_t nErrorCount = 0;
+
+        for (int64_t nBase = std::numeric_limits<int32_t>::min(); nBase <= std::numeric_limits<int32_t>::max(); nBase += CHUNK_SIZE)
+        {
+            for (size_t i = 0; i < CHUNK_SIZE; ++i)
+            {
+                vSrc[i] = static_cast<int32_t>(nBase + static_cast<int64_t>(i));
+            }
+            // 벡터 루프 뒤 스칼라 꼬리까지 거치도록 길이를 블록 크기의 배수가 아니게 나눠서 호출
+            batch(vSrc.data(), vDst.data(), CHUNK_SIZE - 3);
+            batch(vSrc.data() + CHUNK_SIZE - 3, vDst.data() + CHUNK_SIZE - 3, 3);
+
+            for (size_t i = 0; i < CHUNK_SIZE; ++i)
+            {
+                const int32_t nExpected = static_cast<int32_t>(vSrc[i] / N);
+                const int32_t nScalar = scalar(vSrc[i]);
+                if (nScalar != nExpected ||
+                    vDst[i] != nExpected)
+                {
+                    if (nErrorCount < 10)
+                    {
+                        std::printf("  %s(%d): expected %d, scalar %d, batch %d\n", pszName, vSrc[i], nExpected, nScalar, vDst[i]);
+                    }
+                    ++nErrorCount;
+                }
+            }
+        }
+        std::printf("%-16s: %s (%llu errors / 4294967296)\n", pszName, nErrorCount == 0 ? "OK" : "FAIL",
+            static_cast<unsigned long long>(nErrorCount));
+        return nErrorCount;
+    }
+
+    template <int64_t N>
+    uint64_t VerifyDivConst(const char* pszName)
+    {
+        return VerifyAll<N>(pszName,
+            [](int32_t nDiv) { return calc::DivConst<N>::Div(nDiv); },
+            [](const int32_t* pSrc, int32_t* pDst, size_t nCount) { calc::DivConst<N>::Div(pSrc, pDst, nCount); });
+    }
+}
+
+int main()
+{
+    uint64_t nErrorCount = 0;
+    nErrorCount += VerifyAll<10>("Div10",
+        [](int32_t nDiv) { return calc::Div10(nDiv); },
+        [](const int32_t* pSrc, int32_t* pDst, size_t nCount) { calc::Div10(pSrc, pDst, nCount); });
+    nErrorCount += VerifyAll<100>("Div100",
+        [](int32_t nDiv) { return calc::Div100(nDiv); },
+        [](const int32_t* pSrc, int32_t* pDst, size_t nCount) { calc::Div100(pSrc, pDst, nCount); });
+    nErrorCount += VerifyAll<1000>("Div1000",
+        [](int32_t nDiv) { return calc::Div1000(nDiv); },
+        [](const int32_t* pSrc, int32_t* pDst, size_t nCount) { calc::Div1000(pSrc, pDst, nCount); });
+
+    // 시프트 방식이 다른 제수 (음수, 2의 거듭제곱, 보정 덧셈이 필요한 7, 32비트 범위 밖)
+    nErrorCount += VerifyDivConst<7>("DivConst<7>");
+    nErrorCount += VerifyDivConst<-3>("DivConst<-3>");
+    nErrorCount += VerifyDivConst<1024>("DivConst<1024>");
+    nErrorCount += VerifyDivConst<std::numeric_limits<int32_t>::max()>("DivConst<INT_MAX>");
+    nErrorCount += VerifyDivConst<(static_cast<int64_t>(1) << 31) + 5>("DivConst<2^31+5>");
+
+    return nErrorCount == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+﻿/**
+* @file			IniVerify.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		INI Utility 검증 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		빌드 예)
+*				g++ -std=c++20 -O2 -I.. IniVerify.cpp -o IniVerify
+*				cl /std:c++20 /O2 /EHsc /I.. IniVerify.cpp
+*				실패가 없으면 0을 반환
+*/
+
+#include "Ini.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    int g_nErrorCount = 0;
+
+    void Check(bool bIsOk, const char* pszName)
+    {
+        if (!bIsOk)
+        {
+            std::printf("FAIL: %s\n", pszName);
+            ++g_nErrorCount;
+        }
+    }
+
+    /**
+    * @brief        SetValue -> BuildText -> 다시 파싱했을 때 같은 이름/값으로 읽히는지 확인
+    */
+    void CheckRoundTrip(std::string_view svSource, std::string_view svSection, std::string_view svKey, std::string_view svValue)
+    {
+        ini::IniEditor editor;
+        editor.LoadText(svSource);
+        if (!editor.SetValue(svSection, svKey, svValue))
+        {
+            std::printf("FAIL: SetValue refused [%.*s] %.*s=%.*s\n", static_cast<int>(svSection.size()), svSection.data(),
+                static_cast<int>(svKey.size()), svKey.data(), static_cast<int>(svValue.size()), svValue.data());
+            ++g_nErrorCount;
+            return;
+        }
+
+        const std::string strText = editor.BuildText();
+        ini::IniDocument doc;
+        doc.LoadText(strText);
+        if (!doc.HasKey(svSection, svKey) ||
+            doc.GetString(svSection, svKey) != svValue)
+        {
+            std::printf("FAIL: round trip [%.*s] %.*s=%.*s\n---\n%s---\n", static_cast<int>(svSection.size()), svSection.data(),
+                static_cast<int>(svKey.size()), svKey.data(), static_cast<int>(svValue.size()), svValue.data(), strText.c_str());
+            ++g_nErrorCount;
+        }
+    }
+
+    void VerifyEditorRoundTrip()
+    {
+        constexpr std::string_view SOURCE = "[a]\nplain=1\nquoted=\"old\"\nsingle='old'\n";
+
+        // 다시 읽을 수 없는 이름/값은 거부
+        ini::IniEditor editor;
+        editor.LoadText(SOURCE);
+        Check(!editor.SetValue("a", ";k", "1"), "key starting with ';'");
+        Check(!editor.SetValue("a", "#k", "1"), "key starting with '#'");
+        Check(!editor.SetValue("a", "[k", "1"), "key starting with '['");
+        Check(!editor.SetValue("a", " k", "1"), "key with leading space");
+        Check(!editor.SetValue("a", "k\t", "1"), "key with trailing tab");
+        Check(!editor.SetValue(" a", "k", "1"), "section with leading space");
+        Check(!editor.SetValue("a", "k", "\"a'b"), "value quoted with both quotes (leading quote)");
+        Check(!editor.SetValue("a", "k", " x\"y' "), "value quoted with both quotes (surrounding space)");
+        Check(!editor.SetValue("a", "k", "'a\""), "value quoted with both quotes (leading single quote)");
+        Check(!editor.HasPendingEdits(), "refused edits are not recorded");
+
+        // 새 키
+        CheckRoundTrip(SOURCE, "a", "k;", "1");
+        CheckRoundTrip(SOURCE, "a", "k", "a\"b'c");
+        CheckRoundTrip(SOURCE, "a", "k", " x\"y ");
+        CheckRoundTrip(SOURCE, "a", "k", "\"a");
+        CheckRoundTrip(SOURCE, "a", "k", "'a");
+        CheckRoundTrip(SOURCE, "a", "k", "x\f");
+        CheckRoundTrip(SOURCE, "b", "k", " v ");
+
+        // 기존 키 (따옴표 유지/교체)
+        CheckRoundTrip(SOURCE, "a", "plain", " padded ");
+        CheckRoundTrip(SOURCE, "a", "quoted", "it\"s");
+        CheckRoundTrip(SOURCE, "a", "quoted", "a\"b'c");
+        CheckRoundTrip(SOURCE, "a", "single", "it's");
+        CheckRoundTrip(SOURCE, "a", "single", "");
+    }
+
+    /**
+    * @brief        재로드 콜백 안에서 Reload/Stop을 호출해도 멈추지 않는지 확인 (감시 스레드에서 호출됨)
+    */
+    void VerifyConfigCallback()
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "EskUtilIniVerify.ini";
+        std::ofstream(path) << "[a]\nk=1\n";
+
+        std::atomic<int> nCallCount{ 0 };
+        std::atomic<bool> bIsDone{ false };
+        {
+            ini::IniConfig config(path.string(), std::chrono::milliseconds(5));
+            config.SetReloadCallback([&](const ini::IniConfig::Snapshot& pSnapshot)
+                {
+                    // 1: Start, 2: 파일 변경, 3: 콜백 안의 Reload
+                    if (++nCallCount == 2)
+                    {
+                        config.Reload();
+                        config.Stop();
+                        bIsDone = pSnapshot->GetString("a", "k") == "2";
+                    }
+                });
+            Check(config.Start(), "IniConfig::Start");
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            std::ofstream(path) << "[a]\nk=2\n";
+            for (int i = 0; i < 1000 && nCallCount < 3; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            Check(nCallCount == 3 && bIsDone, "Reload/Stop inside reload callback");
+            Check(config.GetVersion() == 3, "IniConfig version after nested Reload");
+        }
+        std::filesystem::remove(path);
+    }
+
+    /**
+    * @brief        여러 스레드가 같은 파일에 WriteFileAtomic을 해도 모두 성공하고 한 스레드의 내용만 남는지 확인
+    */
+    void VerifyConcurrentWrite()
+    {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "EskUtilIniVerify";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const std::string strFile = (dir / "a.ini").string();
+
+        constexpr int THREAD_COUNT = 8;
+        constexpr size_t TEXT_SIZE = 200000;
+        std::atomic<int> nFailCount{ 0 };
+        std::vector<std::thread> vThreads;
+        for (int i = 0; i < THREAD_COUNT; ++i)
+        {
+            vThreads.emplace_back([&, i]()
+                {
+                    const std::string strText(TEXT_SIZE, static_cast<char>('a' + i));
+                    for (int j = 0; j < 20; ++j)
+                    {
+                        if (!ini::detail::WriteFileAtomic(strFile.c_str(), strText))
+                        {
+                            ++nFailCount;
+                        }
+                    }
+                });
+        }
+        for (std::thread& thread : vThreads)
+        {
+            thread.join();
+        }
+
+        std::vector<char> vData;
+        Check(nFailCount == 0, "WriteFileAtomic from concurrent writers");
+        Check(ini::detail::ReadFile(strFile.c_str(), &vData) &&
+            vData.size() == TEXT_SIZE &&
+            std::string(vData.begin(), vData.end()) == std::string(TEXT_SIZE, vData[0]), "WriteFileAtomic result is one whole write");
+        Check(std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator()) == 1, "WriteFileAtomic leaves no temp file");
+        std::filesystem::remove_all(dir);
+    }
+}
+
+int main()
+{
+    VerifyEditorRoundTrip();
+    VerifyConfigCallback();
+    VerifyConcurrentWrite();
+    std::printf("%s (%d errors)\n", g_nErrorCount == 0 ? "OK" : "FAIL", g_nErrorCount);
+    return g_nErrorCount == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+﻿/**
+* @file			StringVerify.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		String Utility 검증 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		빌드 예)
+*				cl /std:c++20 /O2 /EHsc /I.. StringVerify.cpp
+*				실패가 없으면 0을 반환
+*/
+
+#include "String.h"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    int g_nErrorCount = 0;
+
+    void Check(bool bIsOk, const char* pszName)
+    {
+        if (!bIsOk)
+        {
+            std::printf("FAIL: %s\n", pszName);
+            ++g_nErrorCount;
+        }
+    }
+
+    void VerifyFixedString()
+    {
+        using Id = str::FixedString<32>;
+
+        // 리터럴
+        constexpr Id literal("abc");
+        static_assert(literal.GetSize() == 3);
+        static_assert(literal == "abc" && "abc" == literal && literal != "abcd");
+        static_assert(literal < "abd" && (literal <=> std::string_view("abc")) == 0);
+
+        // 리터럴이 아닌 char 배열 (뒤쪽이 '\0'으로 채워진 버퍼)
+        char arrBuffer[16] = "abc";
+        Id fromBuffer(arrBuffer);
+        Check(fromBuffer.GetSize() == 3, "FixedString(char[16]) size");
+        Check(fromBuffer == arrBuffer, "FixedString == char[16]");
+        Check(fromBuffer == literal, "FixedString(char[16]) == literal");
+        Check((fromBuffer <=> arrBuffer) == 0, "FixedString <=> char[16]");
+
+        // '\0'이 없는 배열은 M - 1 글자까지만 사용
+        char arrFull[4] = { 'w', 'x', 'y', 'z' };
+        Check(Id(arrFull) == "wxy", "FixedString(unterminated char[4])");
+    }
+
+    /**
+    * @brief        Split의 기준 구현 (한 글자씩 검사)
+    */
+    std::vector<std::string_view> SplitReference(std::string_view svText, std::string_view svDelims, size_t nMaxCount, bool bIsSkipEmpty)
+    {
+        std::vector<std::string_view> vOut;
+        size_t nStart = 0;
+        for (size_t i = 0; i < svText.size() && vOut.size() + 1 < nMaxCount; ++i)
+        {
+            if (svDelims.find(svText[i]) != std::string_view::npos)
+            {
+                if (!bIsSkipEmpty ||
+                    i > nStart)
+                {
+                    vOut.push_back(svText.substr(nStart, i - nStart));
+                }
+                nStart = i + 1;
+            }
+        }
+        while (bIsSkipEmpty &&
+            nStart < svText.size() &&
+            svDelims.find(svText[nStart]) != std::string_view::npos)
+        {
+            ++nStart;
+        }
+        if (!bIsSkipEmpty ||
+            nStart < svText.size())
+        {
+            vOut.push_back(svText.substr(nStart));
+        }
+        return vOut;
+    }
+
+    bool IsSplitEqual(std::string_view svText, std::string_view svDelims, size_t nMaxCount, bool bIsSkipEmpty)
+    {
+        std::vector<std::string_view> vOut(nMaxCount);
+        const size_t nCount = str::Split(svText, svDelims, vOut.data(), nMaxCount, bIsSkipEmpty);
+        vOut.resize(nCount);
+        return vOut == SplitReference(svText, svDelims, nMaxCount, bIsSkipEmpty);
+    }
+
+    void VerifySplit()
+    {
+        std::string_view arrOut[4];
+        size_t nCount = str::Split("a,,b,c", ",", arrOut, 2, true);
+        Check(nCount == 2 && arrOut[0] == "a" && arrOut[1] == "b,c", "Split skip-empty remainder");
+        nCount = str::Split("a,,b,c", ",", arrOut, 2, false);
+        Check(nCount == 2 && arrOut[0] == "a" && arrOut[1] == ",b,c", "Split keep-empty remainder");
+        nCount = str::Split(",,a", ",", arrOut, 1, true);
+        Check(nCount == 1 && arrOut[0] == "a", "Split skip-empty single slot");
+        nCount = str::Split("a,,,", ",", arrOut, 2, true);
+        Check(nCount == 1 && arrOut[0] == "a", "Split skip-empty remainder of delimiters only");
+
+        // SIMD 블록(16/32바이트)을 넘는 연속 구분자
+        const std::string strLong = "a" + std::string(70, ',') + "b,c";
+        nCount = str::Split(strLong, ",", arrOut, 2, true);
+        Check(nCount == 2 && arrOut[0] == "a" && arrOut[1] == "b,c", "Split skip-empty remainder across SIMD blocks");
+
+        // 무작위 입력을 기준 구현과 비교 (구분자 8개 이하는 SIMD 경로, 초과는 스칼라 경로)
+        std::mt19937 rng(7);
+        constexpr std::string_view ALPHABET = "ab, ;\t|:-";
+        constexpr std::string_view DELIMS[] = { ",", " ,", ", ;\t|:-", ", ;\t|:-ab" };
+        bool bIsOk = true;
+        for (int nRound = 0; nRound < 20000 && bIsOk; ++nRound)
+        {
+            std::string strText(rng() % 100, ' ');
+            for (char& ch : strText)
+            {
+                ch = ALPHABET[rng() % ALPHABET.size()];
+            }
+            const std::string_view svDelims = DELIMS[rng() % std::size(DELIMS)];
+            const size_t nMaxCount = 1 + rng() % 12;
+            bIsOk = IsSplitEqual(strText, svDelims, nMaxCount, false) &&
+                IsSplitEqual(strText, svDelims, nMaxCount, true);
+        }
+        Check(bIsOk, "Split matches reference on random input");
+    }
+}
+
+int main()
+{
+    VerifyFixedString();
+    VerifySplit();
+    std::printf("%s (%d errors)\n", g_nErrorCount == 0 ? "OK" : "FAIL", g_nErrorCount);
+    return g_nErrorCount == 0 ? 0 : 1;
+}
\ No newline at end of file
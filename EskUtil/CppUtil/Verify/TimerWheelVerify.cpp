@@ -0,0 +1,86 @@
+﻿/**
+* @file			TimerWheelVerify.cpp
+* @author		yc.jeon (Eskeptor)
+* @date			2026-10-18
+* @version		0.0.4
+* @brief		TimerWheel 콜백 안 Stop 검증 (라이브러리 빌드에는 포함되지 않는 단독 실행 파일)
+* @details		콜백 안에서 Stop을 호출한 뒤 재시작/소멸이 정상 동작하는지 확인한다. (작업 스레드 0개, 1개, 4개)
+*				빌드 예)
+*				g++ -std=c++20 -O2 -pthread -I.. TimerWheelVerify.cpp -o TimerWheelVerify
+*				cl /std:c++20 /O2 /EHsc /I.. TimerWheelVerify.cpp
+*				실패가 없으면 0을 반환
+*/
+
+#include "Timer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    using namespace esk::gearforge::util;
+
+    /**
+    * @brief        bFlag가 true가 될 때까지 최대 1초 대기
+    */
+    bool WaitFor(const std::atomic<bool>& bFlag)
+    {
+        for (int i = 0; i < 1000 && !bFlag.load(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return bFlag.load();
+    }
+
+    bool VerifyStopInCallback(size_t nWorkerCount)
+    {
+        bool bIsOk = true;
+        {
+            timer::TimerWheel wheel(std::chrono::milliseconds(1), nWorkerCount);
+            std::atomic<bool> bIsStopped{ false };
+            std::atomic<bool> bIsRestartRefused{ false };
+            wheel.AddOneShot(std::chrono::milliseconds(2), [&]()
+                {
+                    wheel.Stop();
+                    bIsRestartRefused = !wheel.Start();
+                    bIsStopped = true;
+                });
+            wheel.Start();
+            bIsOk &= WaitFor(bIsStopped) && bIsRestartRefused.load();
+
+            // 콜백 밖에서는 다시 시작 가능
+            std::atomic<bool> bIsFired{ false };
+            wheel.AddOneShot(std::chrono::milliseconds(2), [&]() { bIsFired = true; });
+            bIsOk &= wheel.Start();
+            bIsOk &= WaitFor(bIsFired);
+            wheel.Stop();
+        }
+        {
+            // Stop 후 바로 소멸 (소멸자에서 남은 스레드 join)
+            timer::TimerWheel wheel(std::chrono::milliseconds(1), nWorkerCount);
+            std::atomic<bool> bIsStopped{ false };
+            wheel.AddPeriodic(std::chrono::milliseconds(1), [&]()
+                {
+                    wheel.Stop();
+                    bIsStopped = true;
+                });
+            wheel.Start();
+            bIsOk &= WaitFor(bIsStopped);
+        }
+        std::printf("stop in callback (workers %zu): %s\n", nWorkerCount, bIsOk ? "OK" : "FAIL");
+        return bIsOk;
+    }
+}
+
+int main()
+{
+    bool bIsOk = true;
+    for (int nRound = 0; nRound < 20; ++nRound)
+    {
+        bIsOk &= VerifyStopInCallback(0);
+        bIsOk &= VerifyStopInCallback(1);
+        bIsOk &= VerifyStopInCallback(4);
+    }
+    return bIsOk ? 0 : 1;
+}
\ No newline at end of file